@@ -22,12 +22,17 @@
 
 // Local Includes
 #include "libmesh/ghosting_functor.h"
+#include "libmesh/threads.h"
+
+// C++ Includes
+#include <vector>
 
 namespace libMesh
 {
 
 // Forward declarations
 class PeriodicBoundaries;
+class PointLocatorBase;
 
 
 /**
@@ -51,7 +56,8 @@ public:
     _periodic_bcs(libmesh_nullptr),
 #endif
     _mesh(libmesh_nullptr),
-    _n_levels(0)
+    _n_levels(0),
+    _cached_revision(0)
   {}
 
   // Change coupling matrix after construction
@@ -104,12 +110,36 @@ public:
 
 private:
 
+  /**
+   * Fills \p neighbors with the active elements which share a side
+   * with \p elem, directly or across a periodic boundary.  The lists
+   * are cached until the revision of \p _mesh changes or
+   * mesh_reinit() is called.
+   */
+  void active_side_neighbors (const Elem * elem,
+                              const PointLocatorBase * point_locator,
+                              std::vector<const Elem *> & neighbors);
+
   const CouplingMatrix * _dof_coupling;
 #ifdef LIBMESH_ENABLE_PERIODIC
   const PeriodicBoundaries * _periodic_bcs;
 #endif
   const MeshBase * _mesh;
   unsigned int _n_levels;
+
+  /**
+   * Active side neighbors of each element we have been asked about,
+   * valid for revision \p _cached_revision of \p _mesh.
+   */
+  LIBMESH_BEST_UNORDERED_MAP<const Elem *, std::vector<const Elem *> >
+  _neighbor_cache;
+
+  unsigned int _cached_revision;
+
+  /**
+   * Sparsity pattern construction queries us from multiple threads.
+   */
+  Threads::spin_mutex _neighbor_cache_mutex;
 };
 
 } // namespace libMesh
@@ -23,6 +23,7 @@
 // Local Includes
 #include "libmesh/libmesh_common.h"
 #include "libmesh/auto_ptr.h"
+#include "libmesh/enum_elem_type.h"
 #include "libmesh/enum_order.h"
 #include "libmesh/reference_counted_object.h"
 #include "libmesh/libmesh.h" // libMesh::invalid_uint
@@ -100,6 +101,136 @@ class DofConstraints : public std::map<dof_id_type,
 {
 };
 
+/**
+ * A read-only, flattened copy of DofConstraints for applying
+ * finalized constraints.  The constrained dofs are kept in a sorted
+ * array, and the constraint row of the constrained dof with index r
+ * occupies entries [row_begin(r), row_end(r)) of contiguous
+ * constraining dof and coefficient arrays, in compressed sparse row
+ * fashion.  This avoids the per-entry allocations and pointer
+ * chasing of the map-of-maps storage wherever constraints are
+ * applied rather than built.
+ */
+class FlatDofConstraints
+{
+public:
+  FlatDofConstraints () : _mask_bits(0), _built(false) {}
+
+  /**
+   * The index returned by find() for unconstrained dofs.
+   */
+  static const std::size_t invalid_row = static_cast<std::size_t>(-1);
+
+  /**
+   * Replaces any existing contents with a copy of \p constraints.
+   */
+  void build (const DofConstraints & constraints);
+
+  /**
+   * Drops all rows and marks this object as not built.
+   */
+  void clear ();
+
+  /**
+   * \returns \p true if build() has been called since the last clear().
+   */
+  bool built () const { return _built; }
+
+  /**
+   * \returns The number of constrained dofs.
+   */
+  std::size_t size () const { return _constrained_dofs.size(); }
+
+  /**
+   * \returns The row index of the constraint on \p dof, or
+   * \p invalid_row if \p dof is not constrained.
+   */
+  std::size_t find (const dof_id_type dof) const
+  {
+    if (!this->maybe_constrained(dof))
+      return invalid_row;
+
+    const std::size_t r = this->lower_bound(dof);
+    return (r != _constrained_dofs.size() &&
+            _constrained_dofs[r] == dof) ? r : invalid_row;
+  }
+
+  /**
+   * \returns \p false if \p dof is certainly not constrained.  This
+   * is a constant-time test against a hashed bit mask of the
+   * constrained dofs; a \p true return may be a false positive.
+   */
+  bool maybe_constrained (const dof_id_type dof) const
+  { return !_constrained_dofs.empty() && _mask[dof & _mask_bits]; }
+
+  /**
+   * \returns \p true if any of \p dofs is constrained.
+   */
+  bool any_constrained (const std::vector<dof_id_type> & dofs) const;
+
+  /**
+   * \returns The row index of the first constrained dof not less
+   * than \p dof, or size() if there is none.
+   */
+  std::size_t lower_bound (const dof_id_type dof) const
+  {
+    return std::lower_bound(_constrained_dofs.begin(),
+                            _constrained_dofs.end(), dof) -
+      _constrained_dofs.begin();
+  }
+
+  /**
+   * \returns The constrained dof of row \p r.
+   */
+  dof_id_type constrained_dof (const std::size_t r) const
+  { return _constrained_dofs[r]; }
+
+  /**
+   * \returns The first entry of row \p r.
+   */
+  std::size_t row_begin (const std::size_t r) const
+  { return _row_offsets[r]; }
+
+  /**
+   * \returns One past the last entry of row \p r.
+   */
+  std::size_t row_end (const std::size_t r) const
+  { return _row_offsets[r+1]; }
+
+  /**
+   * \returns The constraining dof of entry \p k.
+   */
+  dof_id_type dof (const std::size_t k) const
+  { return _dofs[k]; }
+
+  /**
+   * \returns The coefficient of entry \p k.
+   */
+  Real coef (const std::size_t k) const
+  { return _coefs[k]; }
+
+  /**
+   * Swaps the contents of this object with \p other.
+   */
+  void swap (FlatDofConstraints & other);
+
+private:
+  std::vector<dof_id_type> _constrained_dofs;
+  std::vector<std::size_t> _row_offsets;
+  std::vector<dof_id_type> _dofs;
+  std::vector<Real> _coefs;
+
+  /**
+   * One bit per hash slot, set if any constrained dof hashes there.
+   * The slot of a dof is its low bits, \p dof & \p _mask_bits; dof
+   * ids are numbered contiguously, so this spreads well.
+   */
+  std::vector<bool> _mask;
+  dof_id_type _mask_bits;
+
+  bool _built;
+};
+
 /**
  * Storage for DofConstraint right hand sides for a particular
  * problem.  Each dof id with a non-zero constraint offset
@@ -375,10 +506,10 @@ public:
   { _extra_send_list_function = func; _extra_send_list_context = context; }
 
   /**
-   * Takes the \p _send_list vector (which may have duplicate entries)
-   * and sorts it.  The duplicate entries are then removed, resulting in
-   * a sorted \p _send_list with unique entries.  Also calls any user-provided
-   * methods for adding to the send list.
+   * Calls any user-provided methods for adding to the send list, and
+   * sorts the \p _send_list.  Entries are marked as they are added,
+   * so the result has unique entries, and is read back from those
+   * marks rather than sorted.
    */
   void prepare_send_list ();
 
@@ -635,6 +766,12 @@ public:
                            const unsigned int vn,
                            const bool old_dofs=false) const;
 
+  /**
+   * Finds all the DOFS associated with the element DOFs elem_dofs.
+   * This will account for off-element couplings via hanging nodes.
+   */
+  void find_connected_dofs (std::vector<dof_id_type> & elem_dofs) const;
+
   /**
    * \returns \p true if all degree of freedom indices in \p
    * dof_indices are either local indices or in the \p send_list.
@@ -662,6 +799,39 @@ public:
    */
   void set_implicit_neighbor_dofs(bool implicit_neighbor_dofs);
 
+  /**
+   * Allow the reverse Cuthill-McKee dof ordering to be enabled
+   * programmatically.  This overrides the --rcm_dofs commandline
+   * option.  When enabled, each processor numbers its local dofs in
+   * the reverse Cuthill-McKee order of its active local elements'
+   * side neighbor graph, rather than in element iteration order.
+   * The numbering stays variable-major (or node-major, with
+   * --node_major_dofs), so each variable group's local dofs remain a
+   * contiguous block, suitable for fieldsplit preconditioning, while
+   * the dofs within each block have a small bandwidth.
+   */
+  void set_reverse_cuthill_mckee_dofs(bool reverse_cuthill_mckee_dofs);
+
+  /**
+   * Enables or disables caching of the dof indices of all active
+   * local elements in one contiguous, CSR-style table.  The table is
+   * built at the end of each \p distribute_dofs() and discarded by
+   * \p reinit() and \p clear(); while it is valid, \p dof_indices()
+   * calls for cached elements (for all variables or for a single
+   * variable at the element's own p level) are answered by a copy
+   * out of the table instead of by walking the element's nodes.
+   *
+   * The cache is disabled by default.  Enabling it takes effect at
+   * the next \p distribute_dofs().
+   */
+  void set_cache_elem_dof_indices(bool cache_elem_dof_indices);
+
+  /**
+   * \returns \p true if the element dof indices cache is enabled.
+   */
+  bool cache_elem_dof_indices() const
+  { return _cache_elem_dof_indices; }
+
   /**
    * Tells other library functions whether or not this problem
    * includes coupling between dofs in neighboring cells, as can
@@ -811,12 +981,14 @@ public:
   {
     libmesh_assert(_stashed_dof_constraints.empty());
     _dof_constraints.swap(_stashed_dof_constraints);
+    _flat_dof_constraints.swap(_stashed_flat_dof_constraints);
   }
 
   void unstash_dof_constraints()
   {
     libmesh_assert(_dof_constraints.empty());
     _dof_constraints.swap(_stashed_dof_constraints);
+    _flat_dof_constraints.swap(_stashed_flat_dof_constraints);
   }
 
 #ifdef LIBMESH_ENABLE_NODE_CONSTRAINTS
@@ -839,6 +1011,15 @@ public:
    */
   bool is_constrained_dof (const dof_id_type dof) const;
 
+  /**
+   * \returns \p true if any of the degrees of freedom in \p dofs is
+   * constrained, \p false otherwise.  Once constraints have been
+   * processed this costs a constant-time check per unconstrained
+   * dof, so assembly loops may use it to skip all constraint work on
+   * unconstrained elements.
+   */
+  bool has_constrained_dofs (const std::vector<dof_id_type> & dofs) const;
+
   /**
    * \returns \p true if the system has any heterogenous constraints for
    * adjoint solution \p qoi_num, \p false otherwise.
@@ -1242,6 +1423,67 @@ private:
 #endif
                      ) const;
 
+  /**
+   * Helper function that copies the cached dof indices of variables
+   * \p v_begin up to (but not including) \p v_end on \p elem into
+   * \p di.  \returns \p false, leaving \p di untouched, if there is
+   * no valid cache entry for \p elem.
+   */
+  bool cached_dof_indices (const Elem * const elem,
+                           std::vector<dof_id_type> & di,
+                           const unsigned int v_begin,
+                           const unsigned int v_end) const;
+
+  /**
+   * Builds the element dof indices table for the active local
+   * elements of \p mesh.
+   */
+  void build_elem_dof_indices_cache (const MeshBase & mesh);
+
+  /**
+   * Discards the element dof indices table.
+   */
+  void clear_elem_dof_indices_cache ();
+
+  /**
+   * The number of dofs on each node, and on the interior, of an
+   * element of one type for one approximation order.
+   */
+  struct ElemDofLayout
+  {
+    ElemDofLayout () : n_dofs_per_elem(0) {}
+
+    std::vector<unsigned int> n_dofs_at_node;
+    unsigned int n_dofs_per_elem;
+  };
+
+  /**
+   * \returns The layout of variable group \p vg on elements of type
+   * \p t with (p refined) order \p o, or \p NULL if \p reinit() has
+   * not cached it.  Safe to call from threads.
+   */
+  const ElemDofLayout * cached_elem_dof_layout (const unsigned int vg,
+                                                const ElemType t,
+                                                const unsigned int o) const;
+
+  /**
+   * \returns The layout of variable group \p vg, whose p refined type
+   * on \p elem is \p fe_type, computing and caching it first if
+   * necessary.  Not thread safe.
+   */
+  const ElemDofLayout & cache_elem_dof_layout (const unsigned int vg,
+                                               const Elem & elem,
+                                               const FEType & fe_type);
+
+  /**
+   * Helper function that appends the dof indices of the SCALAR
+   * variable \p vn to \p di, avoiding the temporary vector that
+   * a call to \p SCALAR_dof_indices() would require.
+   */
+  void append_SCALAR_dof_indices (std::vector<dof_id_type> & di,
+                                  const unsigned int vn,
+                                  const bool old_dofs=false) const;
+
   /**
    * Builds a sparsity pattern
    */
@@ -1252,6 +1494,15 @@ private:
    */
   void invalidate_dofs(MeshBase & mesh) const;
 
+  /**
+   * Adds \p offset to every DoF index numbered on this processor,
+   * turning the temporary 0-based numbering computed by
+   * \p distribute_local_dofs_var_major() or
+   * \p distribute_local_dofs_node_major() into the final one.
+   */
+  void shift_local_dofs(MeshBase & mesh,
+                        const dof_id_type offset) const;
+
   /**
    * \returns The Node pointer with index \p i from the \p mesh.
    */
@@ -1303,6 +1554,29 @@ private:
   void distribute_local_dofs_node_major (dof_id_type & next_free_dof,
                                          MeshBase & mesh);
 
+  /**
+   * Numbers the dofs of variable groups [\p vg_begin, \p vg_end) on
+   * \p local_elems and their local nodes in parallel, starting at
+   * \p next_free_dof.  The numbering is identical to the serial
+   * element loops of \p distribute_local_dofs_node_major() (all
+   * groups) and \p distribute_local_dofs_var_major() (one group at a
+   * time).
+   */
+  void number_local_elem_dofs (dof_id_type & next_free_dof,
+                               MeshBase & mesh,
+                               const std::vector<Elem *> & local_elems,
+                               unsigned int vg_begin,
+                               unsigned int vg_end) const;
+
+  /**
+   * Fills \p elems with the active local elements, in the order in
+   * which the local dofs are to be numbered: the reverse Cuthill-McKee
+   * order if that has been requested, the mesh iteration order
+   * otherwise.
+   */
+  void local_elements_in_dof_order (MeshBase & mesh,
+                                    std::vector<Elem *> & elems) const;
+
   /*
    * A utility method for obtaining a set of elements to ghost along
    * with merged coupling matrices.
@@ -1322,8 +1596,19 @@ private:
    */
   void add_neighbors_to_send_list(MeshBase & mesh);
 
+  /**
+   * Adds \p dof to the \p _send_list, unless it is already there.
+   */
+  void add_to_send_list (const dof_id_type dof);
+
 #ifdef LIBMESH_ENABLE_CONSTRAINTS
 
+  /**
+   * \returns The flattened constraint rows, checking that they are
+   * current whenever any constraints exist.
+   */
+  const FlatDofConstraints & flat_dof_constraints () const;
+
   /**
    * Build the constraint matrix C associated with the element
    * degree of freedom indices elem_dofs. The optional parameter
@@ -1359,12 +1644,6 @@ private:
                                            int qoi_index = -1,
                                            const bool called_recursively=false) const;
 
-  /**
-   * Finds all the DOFS associated with the element DOFs elem_dofs.
-   * This will account for off-element couplings via hanging nodes.
-   */
-  void find_connected_dofs (std::vector<dof_id_type> & elem_dofs) const;
-
   /**
    * Finds all the DofObjects associated with the set in \p objs.
    * This will account for off-element couplings via hanging nodes.
@@ -1429,6 +1708,13 @@ private:
    */
   std::vector<dof_id_type> _send_list;
 
+  /**
+   * For each processor, a bitmap over the dofs it owns marking those
+   * which are in the \p _send_list.  Bitmaps are only allocated for
+   * the processors whose dofs we need.
+   */
+  std::vector<std::vector<unsigned int> > _send_list_marks;
+
   /**
    * Funtion object to call to add extra entries to the sparsity pattern
    */
@@ -1569,6 +1855,13 @@ private:
    */
   DofConstraints _dof_constraints, _stashed_dof_constraints;
 
+  /**
+   * Flattened copies of the above, built by process_constraints()
+   * and cleared whenever the constraint rows are modified.  These
+   * are what the constraint application routines read.
+   */
+  FlatDofConstraints _flat_dof_constraints, _stashed_flat_dof_constraints;
+
   DofConstraintValueMap      _primal_constraint_values;
 
   AdjointDofConstraintValues _adjoint_constraint_values;
@@ -1618,6 +1911,50 @@ private:
    */
   bool _implicit_neighbor_dofs_initialized;
   bool _implicit_neighbor_dofs;
+
+  /**
+   * Bools to indicate if we override the --rcm_dofs commandline
+   * option.
+   */
+  bool _reverse_cuthill_mckee_dofs_initialized;
+  bool _reverse_cuthill_mckee_dofs;
+
+  /**
+   * Should we build the element dof indices table, and is it
+   * currently valid?
+   */
+  bool _cache_elem_dof_indices;
+  bool _elem_dof_cache_valid;
+
+  /**
+   * The element dof indices table.  \p _elem_dof_cache_row maps an
+   * element id to its row (or DofObject::invalid_id), and
+   * \p _elem_dof_cache_elems holds the element of each row so that
+   * stale or foreign elements with the same id are never matched.
+   * The indices of variable \p v on row \p r are stored in
+   * \p _elem_dof_cache_indices between offsets r*n_vars+v and
+   * r*n_vars+v+1 of \p _elem_dof_cache_offsets, so that all
+   * variables of an element form one contiguous range.
+   */
+  std::vector<dof_id_type> _elem_dof_cache_row;
+  std::vector<const Elem *> _elem_dof_cache_elems;
+  std::vector<std::size_t> _elem_dof_cache_offsets;
+  std::vector<dof_id_type> _elem_dof_cache_indices;
+
+  /**
+   * Cached element dof layouts, indexed by variable group, element
+   * type and approximation order.  A layout depends only on these,
+   * so entries are added as \p reinit() meets new element types and
+   * p levels and are only discarded when the variables change.
+   * Entries are never modified outside \p reinit(), so they are
+   * read from threads without locking.
+   */
+  std::vector<std::vector<std::vector<ElemDofLayout> > > _elem_dof_layouts;
+
+  /**
+   * The variable group of each variable.
+   */
+  std::vector<unsigned int> _variable_group_numbers;
 };
 
 
@@ -1671,6 +2008,28 @@ Order DofMap::variable_group_order (const unsigned int vg) const
 
 
 
+inline
+const DofMap::ElemDofLayout *
+DofMap::cached_elem_dof_layout (const unsigned int vg,
+                                const ElemType t,
+                                const unsigned int o) const
+{
+  if (vg >= _elem_dof_layouts.size() ||
+      _elem_dof_layouts[vg].empty())
+    return libmesh_nullptr;
+
+  const std::vector<ElemDofLayout> & order_layouts =
+    _elem_dof_layouts[vg][t];
+
+  if (o >= order_layouts.size() ||
+      order_layouts[o].n_dofs_at_node.empty())
+    return libmesh_nullptr;
+
+  return &order_layouts[o];
+}
+
+
+
 inline
 const FEType & DofMap::variable_type (const unsigned int c) const
 {
@@ -1711,6 +2070,10 @@ bool DofMap::is_constrained_node (const Node *
 inline
 bool DofMap::is_constrained_dof (const dof_id_type dof) const
 {
+  if (_flat_dof_constraints.built())
+    return (_flat_dof_constraints.find(dof) !=
+            FlatDofConstraints::invalid_row);
+
   if (_dof_constraints.count(dof))
     return true;
 
@@ -1718,6 +2081,33 @@ bool DofMap::is_constrained_dof (const dof_id_type dof) const
 }
 
 
+inline
+bool DofMap::has_constrained_dofs (const std::vector<dof_id_type> & dofs) const
+{
+  if (_flat_dof_constraints.built())
+    return _flat_dof_constraints.any_constrained(dofs);
+
+  for (std::size_t i=0; i != dofs.size(); ++i)
+    if (this->is_constrained_dof(dofs[i]))
+      return true;
+
+  return false;
+}
+
+
+inline
+const FlatDofConstraints & DofMap::flat_dof_constraints () const
+{
+  // Rows added since the last process_constraints() would otherwise
+  // be silently ignored
+  if (!_flat_dof_constraints.built() && !_dof_constraints.empty())
+    libmesh_error_msg("ERROR: DofMap constraints were modified after process_constraints();"
+                      << "\ncall process_constraints() again before applying them.");
+
+  return _flat_dof_constraints;
+}
+
+
 inline
 bool DofMap::has_heterogenous_adjoint_constraints (const unsigned int qoi_num) const
 {
@@ -1798,6 +2188,9 @@ inline void DofMap::enforce_constraints_exactly (const System &,
 inline void DofMap::enforce_adjoint_constraints_exactly (NumericVector<Number> &,
                                                          unsigned int) const {}
 
+inline bool DofMap::has_constrained_dofs (const std::vector<dof_id_type> &) const
+{ return false; }
+
 #endif // LIBMESH_ENABLE_CONSTRAINTS
 
 } // namespace libMesh
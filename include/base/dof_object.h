@@ -28,7 +28,9 @@
 #include "libmesh/reference_counted_object.h"
 
 // C++ includes
+#include <algorithm> // std::copy, std::swap
 #include <cstddef>
+#include <iterator> // std::forward_iterator_tag
 #include <vector>
 
 namespace libMesh
@@ -371,6 +373,57 @@ public:
    */
   void pack_indexing(std::back_insert_iterator<std::vector<largest_id_type> > target) const;
 
+  /**
+   * \returns The number of entries our index buffer needs in an
+   * index arena: its size followed by its contents.
+   */
+  std::size_t arena_indexing_size() const
+  { return _idx_buf.size() + 1; }
+
+  /**
+   * Moves our index buffer into \p arena, which must have room for
+   * \p arena_indexing_size() entries and must stay allocated for as
+   * long as we use it.  The buffer is copied back out whenever its
+   * size changes.  Used by \p MeshBase::pack_dof_indices().
+   */
+  void move_indexing_to_arena (dof_id_type * arena)
+  { _idx_buf.move_to_arena(arena); }
+
+  /**
+   * \returns The number of entries our index buffer needs in an
+   * index arena when it shares a layout block with other objects:
+   * a reference to the layout followed by our DoF base indices.
+   */
+  std::size_t compressed_arena_indexing_size() const
+  { return _idx_buf.n_bases() + 1; }
+
+  /**
+   * Fills \p layout with the layout block our index buffer could
+   * share with other objects: the buffer size followed by the buffer
+   * with its DoF base indices blanked out.  Objects with equal layout
+   * blocks have the same systems, variable groups and components.
+   */
+  void indexing_layout (std::vector<dof_id_type> & layout) const
+  { _idx_buf.get_layout(layout); }
+
+  /**
+   * Like \p move_indexing_to_arena(), but stores only our DoF base
+   * indices in \p arena, which must have room for
+   * \p compressed_arena_indexing_size() entries, and refers to
+   * \p layout, an earlier block of the same arena filled from
+   * \p indexing_layout(), for everything else.  Used by
+   * \p MeshBase::pack_dof_indices().
+   */
+  void compress_indexing_to_arena (dof_id_type * arena,
+                                   const dof_id_type * layout)
+  { _idx_buf.compress_to_arena(arena, layout); }
+
+  /**
+   * Copies our index buffer back out of any arena it was moved to.
+   */
+  void move_indexing_from_arena ()
+  { _idx_buf.localize(); }
+
   /**
    * Print our buffer for debugging.
    */
@@ -410,17 +463,6 @@ private:
    */
   dof_id_type _id;
 
-  /**
-   * The \p processor_id of the \p DofObject.
-   * Degrees of freedom are wholly owned by processors,
-   * however they may be duplicated on other processors.
-   *
-   * This is stored as an unsigned short int since we cannot
-   * expect to be solving on 65000+ processors any time soon,
-   * can we??
-   */
-  processor_id_type _processor_id;
-
   /**
    * DoF index information.  This is packed into a contiguous buffer of the following format:
    *
@@ -472,9 +514,355 @@ private:
    * (Now of course 0-base everything...  but you get the idea.)
    */
   typedef dof_id_type index_t;
-  typedef std::vector<index_t> index_buffer_t;
+
+  /**
+   * The index buffer storage.  This behaves like a std::vector, but
+   * is a single pointer to a block laid out as a header entry
+   * followed by the buffer entries, so that empty buffers cost no
+   * more than a pointer and nonempty ones a single heap allocation.
+   *
+   * The block is either our own heap allocation or a slice of an
+   * index arena owned by the mesh; the lowest bit of the pointer
+   * tells which, so that the arena can be freed before we are.  The
+   * header is the buffer size.  Reads and in-place writes of an arena
+   * slice go straight to the arena; anything that changes the size
+   * first copies the buffer into a block of our own.
+   *
+   * An arena slice can also be compressed: its header is then
+   * \p layout_flag plus its distance past a layout block of the same
+   * arena, which holds everything but the DoF base indices (the odd
+   * entries past the system offsets), and the slice holds only those
+   * base indices.  Writes to anything but a base index first copy
+   * the buffer into a block of our own.
+   */
+  class index_buffer_t
+  {
+  public:
+    typedef index_t * iterator;
+
+    /**
+     * Read-only iteration through whichever storage we are using.
+     */
+    class const_iterator
+    {
+    public:
+      typedef std::forward_iterator_tag iterator_category;
+      typedef index_t                   value_type;
+      typedef std::ptrdiff_t            difference_type;
+      typedef const index_t *           pointer;
+      typedef index_t                   reference;
+
+      const_iterator (const index_buffer_t * buf, std::size_t i) :
+        _buf(buf), _i(i) {}
+
+      index_t operator* () const { return (*_buf)[_i]; }
+
+      const_iterator & operator++ () { ++_i; return *this; }
+
+      const_iterator operator++ (int)
+      { const_iterator old = *this; ++_i; return old; }
+
+      bool operator== (const const_iterator & other) const
+      { return _i == other._i; }
+
+      bool operator!= (const const_iterator & other) const
+      { return _i != other._i; }
+
+    private:
+      const index_buffer_t * _buf;
+      std::size_t _i;
+    };
+
+    static const index_t layout_flag =
+      static_cast<index_t>(1) << (sizeof(index_t)*8 - 1);
+
+    index_buffer_t () :
+      _data(libmesh_nullptr) {}
+
+    index_buffer_t (const index_buffer_t & other) :
+      _data(libmesh_nullptr)
+    { this->assign(other.begin(), other.end()); }
+
+    ~index_buffer_t ()
+    { this->clear(); }
+
+    index_buffer_t & operator= (const index_buffer_t & other)
+    {
+      if (this != &other)
+        index_buffer_t(other).swap(*this);
+      return *this;
+    }
+
+    index_buffer_t & operator= (const std::vector<index_t> & buf)
+    {
+      this->assign(buf.begin(), buf.end());
+      return *this;
+    }
+
+    std::size_t size () const
+    {
+      if (!_data)
+        return 0;
+      if (this->compressed())
+        return static_cast<std::size_t>(this->layout()[0]);
+      return static_cast<std::size_t>(this->data()[0]);
+    }
+
+    bool empty () const
+    { return this->size() == 0; }
+
+    index_t operator[] (const std::size_t i) const
+    {
+      if (!this->compressed())
+        return this->data()[i+1];
+
+      const index_t * layout = this->layout();
+      const std::size_t ns = layout[1];
+      if (i >= ns && (i - ns) % 2)
+        return this->data()[1 + (i - ns)/2];
+      return layout[i+1];
+    }
+
+    index_t & operator[] (const std::size_t i)
+    {
+      if (this->compressed())
+        {
+          // DoF base indices are ours to write; anything else is
+          // shared with other objects
+          const std::size_t ns = this->layout()[1];
+          if (i >= ns && (i - ns) % 2)
+            return this->data()[1 + (i - ns)/2];
+          this->localize();
+        }
+      return this->data()[i+1];
+    }
+
+    const_iterator begin () const
+    { return const_iterator(this, 0); }
+
+    const_iterator end () const
+    { return const_iterator(this, this->size()); }
+
+    iterator begin ()
+    { this->localize(); return _data ? _data + 1 : libmesh_nullptr; }
+
+    iterator end ()
+    { this->localize(); return _data ? _data + 1 + this->size() : libmesh_nullptr; }
+
+    /**
+     * \returns The number of DoF base indices in the buffer.
+     */
+    std::size_t n_bases () const
+    {
+      const std::size_t sz = this->size();
+      return sz ? (sz - (*this)[0]) / 2 : 0;
+    }
+
+    void insert (iterator pos, const index_t val)
+    { this->insert(pos, &val, &val + 1); }
+
+    template <typename InputIterator>
+    void insert (iterator pos, InputIterator first, InputIterator last)
+    {
+      libmesh_assert(this->owned());
+      const std::size_t old_size = this->size();
+      const std::size_t n_before = _data ? pos - (_data + 1) : 0;
+      const std::size_t n_new = std::distance(first, last);
+
+      index_t * block = allocate(old_size + n_new);
+      if (_data)
+        std::copy(_data + 1, _data + 1 + n_before, block + 1);
+      std::copy(first, last, block + 1 + n_before);
+      if (_data)
+        std::copy(_data + 1 + n_before, _data + 1 + old_size,
+                  block + 1 + n_before + n_new);
+      this->reset(block);
+    }
+
+    void erase (iterator first, iterator last)
+    {
+      libmesh_assert(this->owned());
+      if (first == last)
+        return;
+      const std::size_t old_size = this->size();
+      const std::size_t n_before = first - (_data + 1);
+      const std::size_t n_erased = last - first;
+
+      index_t * block = allocate(old_size - n_erased);
+      if (block)
+        {
+          std::copy(_data + 1, first, block + 1);
+          std::copy(last, _data + 1 + old_size, block + 1 + n_before);
+        }
+      this->reset(block);
+    }
+
+    template <typename InputIterator>
+    void assign (InputIterator first, InputIterator last)
+    {
+      index_t * block = allocate(std::distance(first, last));
+      if (block)
+        std::copy(first, last, block + 1);
+      this->reset(block);
+    }
+
+    void clear ()
+    { this->reset(libmesh_nullptr); }
+
+    void resize (const std::size_t n, const index_t val)
+    {
+      const std::size_t old_size = this->size();
+      index_t * block = allocate(n);
+      if (block)
+        {
+          const index_buffer_t & self = *this;
+          for (std::size_t i = 0; i < n && i < old_size; ++i)
+            block[i+1] = self[i];
+          for (std::size_t i = old_size; i < n; ++i)
+            block[i+1] = val;
+        }
+      this->reset(block);
+    }
+
+    void swap (index_buffer_t & other)
+    { std::swap(_data, other._data); }
+
+    /**
+     * Copies the buffer out of an arena into a block of our own, if
+     * it was in one.
+     */
+    void localize ()
+    {
+      if (!this->owned())
+        {
+          const index_buffer_t & self = *this;
+          this->assign(self.begin(), self.end());
+        }
+    }
+
+    /**
+     * Copies the buffer into \p dest, which must have room for
+     * size()+1 entries, frees our own block, and uses \p dest from
+     * now on.
+     */
+    void move_to_arena (index_t * dest)
+    {
+      const index_buffer_t & self = *this;
+      dest[0] = cast_int<index_t>(self.size());
+      std::copy(self.begin(), self.end(), dest + 1);
+      this->reset(tag(dest));
+    }
+
+    /**
+     * Fills \p layout with the buffer size followed by the buffer
+     * with its DoF base indices set to \p invalid_id.
+     */
+    void get_layout (std::vector<index_t> & layout) const
+    {
+      const std::size_t sz = this->size();
+      layout.resize(sz + 1);
+      layout[0] = cast_int<index_t>(sz);
+      std::copy(this->begin(), this->end(), layout.begin() + 1);
+      if (sz)
+        for (std::size_t i = layout[1] + 1; i < sz; i += 2)
+          layout[i+1] = invalid_id;
+    }
+
+    /**
+     * Copies our DoF base indices into \p dest, which must have room
+     * for n_bases()+1 entries and must follow \p layout in the same
+     * arena, frees our own block, and uses \p dest and \p layout from
+     * now on.
+     */
+    void compress_to_arena (index_t * dest, const index_t * layout)
+    {
+      libmesh_assert_greater (dest, layout);
+      libmesh_assert_equal_to (layout[0], this->size());
+
+      const std::size_t offset = dest - layout;
+      libmesh_assert_less (offset, layout_flag);
+
+      const index_buffer_t & self = *this;
+      const std::size_t nb = this->n_bases();
+      if (nb)
+        {
+          const std::size_t ns = self[0];
+          for (std::size_t k = 0; k != nb; ++k)
+            dest[k+1] = self[ns + 2*k + 1];
+        }
+      dest[0] = cast_int<index_t>(layout_flag | offset);
+
+      this->reset(tag(dest));
+    }
+
+  private:
+    /**
+     * Arena slices are stored with the lowest pointer bit set.
+     */
+    static index_t * tag (index_t * arena)
+    {
+      return reinterpret_cast<index_t *>
+        (reinterpret_cast<std::size_t>(arena) | 1);
+    }
+
+    index_t * data () const
+    {
+      return reinterpret_cast<index_t *>
+        (reinterpret_cast<std::size_t>(_data) & ~static_cast<std::size_t>(1));
+    }
+
+    bool owned () const
+    { return !(reinterpret_cast<std::size_t>(_data) & 1); }
+
+    bool compressed () const
+    { return !this->owned() && (this->data()[0] & layout_flag); }
+
+    const index_t * layout () const
+    { return this->data() - (this->data()[0] & ~layout_flag); }
+
+    /**
+     * \returns A new block of our own for \p n entries, or
+     * \p libmesh_nullptr if \p n is zero.
+     */
+    static index_t * allocate (const std::size_t n)
+    {
+      if (!n)
+        return libmesh_nullptr;
+      libmesh_assert_less (n, layout_flag);
+      index_t * block = new index_t[n + 1];
+      block[0] = cast_int<index_t>(n);
+      return block;
+    }
+
+    /**
+     * Frees our own block, if any, and uses \p block from now on.
+     */
+    void reset (index_t * block)
+    {
+      if (this->owned())
+        delete [] _data;
+      _data = block;
+    }
+
+    index_t * _data;
+  };
+
   index_buffer_t _idx_buf;
 
+  /**
+   * The \p processor_id of the \p DofObject.
+   * Degrees of freedom are wholly owned by processors,
+   * however they may be duplicated on other processors.
+   *
+   * This is stored as an unsigned short int since we cannot
+   * expect to be solving on 65000+ processors any time soon,
+   * can we??
+   *
+   * It is stored last so that the small data members of derived
+   * classes can be laid out in our tail padding.
+   */
+  processor_id_type _processor_id;
+
   /**
    * Above we introduced the chimera ncv, which is a hybrid of the form
    * ncv = ncv_magic*nv + nc
@@ -40,7 +40,14 @@ public:
   /**
    * Constructor.
    */
-  GhostPointNeighbors(const MeshBase & mesh) : _mesh(mesh) {}
+  GhostPointNeighbors(const MeshBase & mesh) :
+    _mesh(mesh),
+    _node_elems_valid(false),
+    _node_elems_revision(0),
+    _node_elems_n_elem(0),
+    _node_elems_max_elem_id(0),
+    _node_elems_max_node_id(0)
+  {}
 
   /**
    * For the specified range of active elements, find their point
@@ -52,9 +59,55 @@ public:
                            processor_id_type p,
                            map_type & coupled_elements);
 
+  /**
+   * The mesh has changed, so we forget our node-to-element adjacency.
+   */
+  virtual void mesh_reinit () libmesh_override
+  { _node_elems_valid = false; }
+
+  /**
+   * Elements have been added to the mesh, so we forget our
+   * node-to-element adjacency.
+   */
+  virtual void redistribute () libmesh_override
+  { _node_elems_valid = false; }
+
+  /**
+   * Elements have been deleted from the mesh, so we forget our
+   * node-to-element adjacency.
+   */
+  virtual void delete_remote_elements () libmesh_override
+  { _node_elems_valid = false; }
+
 private:
 
+  /**
+   * \returns The elements containing each node of \p _mesh, rebuilt
+   * if the mesh has changed since we last built them.
+   */
+  const NodeElemAdjacency & node_elems ();
+
   const MeshBase & _mesh;
+
+  /**
+   * The node-to-element adjacency of \p _mesh, which saves each
+   * query a search through every active element; mesh redistribution
+   * queries us once per processor.  We keep our own rather than using
+   * MeshBase::node_elem_adjacency(), because we are queried while
+   * the mesh is being prepared, before its revision changes.
+   */
+  NodeElemAdjacency _node_elems;
+
+  /**
+   * Whether \p _node_elems is valid, and the mesh revision and sizes
+   * it was built for, which catch changes to the mesh between our
+   * queries that none of the hooks above hear about.
+   */
+  bool _node_elems_valid;
+  unsigned int _node_elems_revision;
+  dof_id_type _node_elems_n_elem;
+  dof_id_type _node_elems_max_elem_id;
+  dof_id_type _node_elems_max_node_id;
 };
 
 } // namespace libMesh
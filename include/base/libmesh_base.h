@@ -52,6 +52,14 @@ processor_id_type global_processor_id();
  */
 unsigned int n_threads();
 
+/**
+ * \returns \p true if arrays which are processed by multiple threads
+ * should first be written by those same threads, as requested with
+ * \p --numa-first-touch, so that on NUMA machines their pages land
+ * in memory local to the threads using them.
+ */
+bool numa_first_touch();
+
 /**
  * Namespaces don't provide private data,
  * so let's take the data we would like
@@ -76,6 +84,11 @@ extern processor_id_type _processor_id;
  * Total number of threads possible.
  */
 extern int _n_threads;
+
+/**
+ * Whether --numa-first-touch was given.
+ */
+extern bool _numa_first_touch;
 }
 }
 
@@ -128,6 +141,13 @@ unsigned int libMesh::n_threads()
 }
 
 
+inline
+bool libMesh::numa_first_touch()
+{
+  return libMeshPrivateData::_numa_first_touch;
+}
+
+
 // We now put everything we can into a separate libMesh namespace;
 // code which forward declares libMesh classes or which specializes
 // libMesh templates may want to know whether it is compiling under
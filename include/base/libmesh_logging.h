@@ -66,23 +66,84 @@ struct PerfItem
   PerfItem(const char * label,
            const char * header,
            bool enabled=true) :
-    _label(label),
-    _header(header),
+    _event_id(0),
     _enabled(enabled)
   {
     if (_enabled)
-      libMesh::perflog.push(label, header);
+      {
+        _event_id = libMesh::perflog.get_event_id(label, header);
+        libMesh::perflog.push(_event_id);
+      }
   }
 
+  PerfItem(unsigned int event_id,
+           bool enabled=true) :
+    _event_id(event_id),
+    _enabled(enabled)
+  {
+    if (_enabled)
+      libMesh::perflog.push(_event_id);
+  }
+
+  /**
+   * Used by \p LOG_SCOPE: pushes \p event_id, which \p
+   * static_event_id() looked up once for the call site when \p label
+   * and \p header are string literals.
+   */
+  template <std::size_t N1, std::size_t N2>
+  PerfItem(unsigned int event_id,
+           const char (&)[N1],
+           const char (&)[N2],
+           bool enabled=true) :
+    _event_id(event_id),
+    _enabled(enabled)
+  {
+    if (_enabled)
+      libMesh::perflog.push(_event_id);
+  }
+
+  /**
+   * Used by \p LOG_SCOPE: labels which aren't literals may change
+   * between calls, so they are looked up every time.
+   */
+  PerfItem(unsigned int,
+           const std::string & label,
+           const std::string & header,
+           bool enabled=true) :
+    _event_id(0),
+    _enabled(enabled)
+  {
+    if (_enabled)
+      {
+        _event_id = libMesh::perflog.get_event_id(label, header);
+        libMesh::perflog.push(_event_id);
+      }
+  }
+
+  /**
+   * \returns The event id of a string literal \p label and \p header,
+   * which \p LOG_SCOPE caches for its call site.
+   */
+  template <std::size_t N1, std::size_t N2>
+  static unsigned int static_event_id(const char (&label)[N1],
+                                      const char (&header)[N2])
+  { return libMesh::perflog.get_event_id(label, header); }
+
+  /**
+   * Labels which aren't literals get no cached id.
+   */
+  static unsigned int static_event_id(const std::string &,
+                                      const std::string &)
+  { return 0; }
+
   ~PerfItem()
   {
     if (_enabled)
-      libMesh::perflog.pop(_label, _header);
+      libMesh::perflog.pop(_event_id);
   }
 
 private:
-  const char * _label;
-  const char * _header;
+  unsigned int _event_id;
   bool _enabled;
 };
 
@@ -96,14 +157,24 @@ private:
 // to add performance monitors to the code without
 // impacting performance when performance logging
 // is disabled.
+//
+// LOG_SCOPE looks the event of string literal labels up once per call
+// site, and that of any other labels (which may differ from call to
+// call) every time.  Character arrays count as literals.
 #ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
 
 #  define START_LOG(a,b)   { libMesh::perflog.push(a,b); }
 #  define STOP_LOG(a,b)    { libMesh::perflog.pop(a,b); }
 #  define PALIBMESH_USE_LOG(a,b)   { libmesh_deprecated(); }
 #  define RESTART_LOG(a,b) { libmesh_deprecated(); }
-#  define LOG_SCOPE(a,b)   libMesh::PerfItem TOKENPASTE2(perf_item_, __LINE__)(a,b);
-#  define LOG_SCOPE_IF(a,b,enabled)   libMesh::PerfItem TOKENPASTE2(perf_item_, __LINE__)(a,b,enabled);
+#  define LOG_SCOPE(a,b)                                                \
+  static const unsigned int TOKENPASTE2(perf_event_, __LINE__) =        \
+    libMesh::PerfItem::static_event_id(a, b);                           \
+  libMesh::PerfItem TOKENPASTE2(perf_item_, __LINE__)(TOKENPASTE2(perf_event_, __LINE__), a, b);
+#  define LOG_SCOPE_IF(a,b,enabled)                                     \
+  static const unsigned int TOKENPASTE2(perf_event_, __LINE__) =        \
+    libMesh::PerfItem::static_event_id(a, b);                           \
+  libMesh::PerfItem TOKENPASTE2(perf_item_, __LINE__)(TOKENPASTE2(perf_event_, __LINE__), a, b, enabled);
 
 #else
 
@@ -25,16 +25,20 @@
 #ifdef LIBMESH_ENABLE_PERIODIC
 
 // Local Includes
+#include "libmesh/threads.h"
 #include "libmesh/vector_value.h" // RealVectorValue
 
 // C++ Includes
 #include <map>
+#include <vector>
+#include LIBMESH_INCLUDE_UNORDERED_MAP
 
 namespace libMesh
 {
 
 // Forward Declarations
 class Elem;
+class MeshBase;
 class PeriodicBoundaryBase;
 class PointLocatorBase;
 
@@ -54,16 +58,57 @@ public:
 
   const PeriodicBoundaryBase * boundary(boundary_id_type id) const;
 
-  PeriodicBoundaries() {}
+  PeriodicBoundaries() :
+    _cached_mesh(libmesh_nullptr),
+    _cached_revision(0)
+  {}
 
   ~PeriodicBoundaries();
 
   // The periodic neighbor of \p e in direction \p side, if it
   // exists.  NULL otherwise
+  //
+  // Each (boundary, element, side) is only located once per mesh
+  // revision; repeated queries are answered from a cache.
   const Elem * neighbor(boundary_id_type boundary_id,
                         const PointLocatorBase & point_locator,
                         const Elem * e,
                         unsigned int side) const;
+
+  /**
+   * Forgets all cached periodic neighbors.  The cache is dropped
+   * automatically whenever the mesh revision changes; this is only
+   * needed after changing the transformation of an existing boundary.
+   */
+  void clear_neighbor_cache () const;
+
+private:
+
+  /**
+   * A located periodic neighbor of some element.
+   */
+  struct CachedNeighbor
+  {
+    boundary_id_type boundary_id;
+    unsigned short int side;
+    const Elem * neighbor;
+  };
+
+  /**
+   * The periodic neighbors located so far, by element, valid for
+   * revision \p _cached_revision of \p _cached_mesh.
+   */
+  mutable LIBMESH_BEST_UNORDERED_MAP<const Elem *, std::vector<CachedNeighbor> >
+  _neighbor_cache;
+
+  mutable const MeshBase * _cached_mesh;
+
+  mutable unsigned int _cached_revision;
+
+  /**
+   * Neighbor queries come from threaded loops.
+   */
+  mutable Threads::spin_mutex _neighbor_cache_mutex;
 };
 
 } // namespace libMesh
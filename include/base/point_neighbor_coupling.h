@@ -22,6 +22,10 @@
 
 // Local Includes
 #include "libmesh/ghosting_functor.h"
+#include "libmesh/threads.h"
+
+// C++ Includes
+#include <vector>
 
 namespace libMesh
 {
@@ -51,7 +55,8 @@ public:
     _periodic_bcs(libmesh_nullptr),
 #endif
     _mesh(libmesh_nullptr),
-    _n_levels(0)
+    _n_levels(0),
+    _cached_revision(0)
   {}
 
   // Change coupling matrix after construction
@@ -104,12 +109,34 @@ public:
 
 private:
 
+  /**
+   * Fills \p neighbors with the point neighbors of \p elem.  The
+   * lists are cached until the revision of \p _mesh changes or
+   * mesh_reinit() is called.
+   */
+  void cached_point_neighbors (const Elem * elem,
+                               std::vector<const Elem *> & neighbors);
+
   const CouplingMatrix * _dof_coupling;
 #ifdef LIBMESH_ENABLE_PERIODIC
   const PeriodicBoundaries * _periodic_bcs;
 #endif
   const MeshBase * _mesh;
   unsigned int _n_levels;
+
+  /**
+   * Point neighbors of each element we have been asked about, valid
+   * for revision \p _cached_revision of \p _mesh.
+   */
+  LIBMESH_BEST_UNORDERED_MAP<const Elem *, std::vector<const Elem *> >
+  _neighbor_cache;
+
+  unsigned int _cached_revision;
+
+  /**
+   * Sparsity pattern construction queries us from multiple threads.
+   */
+  Threads::spin_mutex _neighbor_cache_mutex;
 };
 
 } // namespace libMesh
@@ -33,7 +33,8 @@ namespace libMesh
  * This class implements reference counting. Any class that
  * is properly derived from this class will get reference counted, provided
  * that the library is configured with \p --enable-reference-counting
- * and you are compiling with \p DEBUG defined.
+ * and you are compiling with \p DEBUG defined, or the library is
+ * configured with \p --enable-reference-count-statistics.
  * For example, the following is sufficient to define the class \p Foo
  * as a reference counted class:
  *
@@ -55,7 +56,8 @@ namespace libMesh
  *
  * \par
  * If the library is configured with \p --disable-reference-counting
- * or \p DEBUG is not defined then this class does nothing.
+ * or \p DEBUG is not defined, and the library isn't configured with
+ * \p --enable-reference-count-statistics, then this class does nothing.
  * All members are inlined and empty, so they should effectively disappear.
  *
  * \author Benjamin S. Kirk
@@ -73,9 +75,9 @@ protected:
    */
   ReferenceCountedObject ()
   {
-#if defined(LIBMESH_ENABLE_REFERENCE_COUNTING) && defined(DEBUG)
+#ifdef LIBMESH_REFERENCE_COUNT_BY_CLASS
 
-    increment_constructor_count(typeid(T).name());
+    ++counts().creations;
 
 #endif
   }
@@ -86,9 +88,9 @@ protected:
   ReferenceCountedObject (const ReferenceCountedObject & other)
     : ReferenceCounter(other)
   {
-#if defined(LIBMESH_ENABLE_REFERENCE_COUNTING) && defined(DEBUG)
+#ifdef LIBMESH_REFERENCE_COUNT_BY_CLASS
 
-    increment_constructor_count(typeid(T).name());
+    ++counts().creations;
 
 #endif
   }
@@ -100,9 +102,9 @@ protected:
   ReferenceCountedObject(ReferenceCountedObject && other) noexcept
     : ReferenceCounter(std::move(other))
   {
-#if defined(LIBMESH_ENABLE_REFERENCE_COUNTING) && defined(DEBUG)
+#ifdef LIBMESH_REFERENCE_COUNT_BY_CLASS
 
-    increment_constructor_count(typeid(T).name());
+    ++counts().creations;
 
 #endif
   }
@@ -128,12 +130,28 @@ public:
    */
   ~ReferenceCountedObject ()
   {
-#if defined(LIBMESH_ENABLE_REFERENCE_COUNTING) && defined(DEBUG)
+#ifdef LIBMESH_REFERENCE_COUNT_BY_CLASS
 
-    increment_destructor_count(typeid(T).name());
+    ++counts().destructions;
 
 #endif
   }
+
+private:
+
+#ifdef LIBMESH_REFERENCE_COUNT_BY_CLASS
+
+  /**
+   * \returns The counts of \p T, which are looked up by name only
+   * the first time.
+   */
+  static ClassCounts & counts ()
+  {
+    static ClassCounts & class_counts_T = class_counts(typeid(T).name());
+    return class_counts_T;
+  }
+
+#endif
 };
 
 
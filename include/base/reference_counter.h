@@ -30,6 +30,13 @@
 #include <string>
 #include <map>
 
+// Objects are counted by class in debug mode, and in every mode when
+// configured with --enable-reference-count-statistics
+#if defined(LIBMESH_ENABLE_REFERENCE_COUNTING) && \
+  (defined(DEBUG) || defined(LIBMESH_ENABLE_REFERENCE_COUNT_STATISTICS))
+#define LIBMESH_REFERENCE_COUNT_BY_CLASS
+#endif
+
 namespace libMesh
 {
 
@@ -95,28 +102,30 @@ public:
 
 protected:
 
-#if defined(LIBMESH_ENABLE_REFERENCE_COUNTING) && defined(DEBUG)
+#ifdef LIBMESH_ENABLE_REFERENCE_COUNTING
 
   /**
-   * Increments the construction counter. Should be called in
-   * the constructor of any derived class that will be
-   * reference counted.
+   * The creations and destructions of the objects of one class.
+   * Each counted class looks its counts up once, then updates them
+   * without locking.
    */
-  void increment_constructor_count (const std::string & name);
+  struct ClassCounts
+  {
+    Threads::atomic<unsigned int> creations;
+    Threads::atomic<unsigned int> destructions;
+  };
 
   /**
-   * Increments the destruction counter. Should be called in
-   * the destructor of any derived class that will be
-   * reference counted.
+   * \returns The counts of the class named \p name, which are
+   * created the first time they are asked for.  Takes the mutex.
    */
-  void increment_destructor_count (const std::string & name);
+  static ClassCounts & class_counts (const std::string & name);
 
   /**
    * Data structure to log the information.  The log is
    * identified by the class name.
    */
-  typedef std::map<std::string, std::pair<unsigned int,
-                                          unsigned int> > Counts;
+  typedef std::map<std::string, ClassCounts> Counts;
 
   /**
    * Actually holds the data.
@@ -176,35 +185,6 @@ inline ReferenceCounter::~ReferenceCounter()
 }
 
 
-
-
-
-
-#if defined(LIBMESH_ENABLE_REFERENCE_COUNTING) && defined(DEBUG)
-inline
-void ReferenceCounter::increment_constructor_count (const std::string & name)
-{
-  Threads::spin_mutex::scoped_lock lock(Threads::spin_mtx);
-  std::pair<unsigned int, unsigned int> & p = _counts[name];
-
-  p.first++;
-}
-#endif
-
-
-
-#if defined(LIBMESH_ENABLE_REFERENCE_COUNTING) && defined(DEBUG)
-inline
-void ReferenceCounter::increment_destructor_count (const std::string & name)
-{
-  Threads::spin_mutex::scoped_lock lock(Threads::spin_mtx);
-  std::pair<unsigned int, unsigned int> & p = _counts[name];
-
-  p.second++;
-}
-#endif
-
-
 } // namespace libMesh
 
 
@@ -87,9 +87,12 @@ private:
   const bool implicit_neighbor_dofs;
   const bool need_full_sparsity_pattern;
 
-  void handle_vi_vj(const Elem * partner,
-                    const std::vector<dof_id_type> & element_dofs_i,
-                    unsigned int vj);
+  /**
+   * Adds the sorted, unique dofs \p element_dofs_j to the rows of
+   * each of the sorted dofs \p element_dofs_i.
+   */
+  void handle_vi_vj(const std::vector<dof_id_type> & element_dofs_i,
+                    const std::vector<dof_id_type> & element_dofs_j);
 
 public:
 
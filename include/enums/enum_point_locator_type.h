@@ -32,6 +32,8 @@ namespace libMesh {
 enum PointLocatorType {TREE = 0,
                        TREE_ELEMENTS,
                        TREE_LOCAL_ELEMENTS,
+                       BVH,
+                       BVH_LOCAL_ELEMENTS,
                        INVALID_LOCATOR};
 }
 
@@ -104,6 +104,25 @@ protected:
    */
   void add_projection(const System &, const Elem *, unsigned int var);
 
+  /**
+   * Evaluates the solution at the quadrature points of the fine
+   * element \p fe was last reinitialized on, whose degrees of freedom
+   * are in \p dof_indices, into \p fine_values, \p fine_grads and
+   * \p fine_hessians.  Derivatives are only evaluated if \p cont
+   * needs them.
+   */
+  void compute_fine_solution(const System &, FEContinuity cont);
+
+  /**
+   * Adds the projection of the fine solution onto the coarse shape
+   * functions to \p Ke and \p Fe.  Only the upper triangle of the
+   * symmetric \p Ke is assembled; \p symmetrize_projection() fills
+   * in the rest once all fine elements have been added.
+   */
+  void add_projection_terms(FEContinuity cont);
+
+  void symmetrize_projection();
+
   /**
    * The coarse element on which a solution projection is cached
    */
@@ -114,6 +133,15 @@ protected:
    */
   std::vector<dof_id_type> dof_indices;
 
+  /**
+   * The solution coefficients on the fine element, and the solution
+   * and its derivatives at its quadrature points
+   */
+  std::vector<Number> Ue;
+  std::vector<Number> fine_values;
+  std::vector<Gradient> fine_grads;
+  std::vector<Tensor> fine_hessians;
+
   /**
    * The finite element objects for fine and coarse elements
    */
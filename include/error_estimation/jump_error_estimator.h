@@ -37,6 +37,7 @@ namespace libMesh
 // Forward Declarations
 class Point;
 class Elem;
+class ElemGeometryCache;
 
 /**
  * This abstract base class implements utility functions for error estimators
@@ -58,6 +59,7 @@ public:
       integrate_boundary_sides(false),
       fine_context(),
       coarse_context(),
+      elem_geometry(libmesh_nullptr),
       fine_error(0),
       coarse_error(0) {}
 
@@ -133,6 +135,14 @@ protected:
    */
   UniquePtr<FEMContext> fine_context, coarse_context;
 
+  /**
+   * The mesh's cached element geometry, for the element sizes the
+   * side integrations scale by; set during estimate_error().  Code
+   * which moves nodes must call MeshBase::mark_modified() for it to
+   * be recomputed.
+   */
+  const ElemGeometryCache * elem_geometry;
+
   /**
    * The fine and coarse error values to be set by each side_integration();
    */
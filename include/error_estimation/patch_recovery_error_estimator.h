@@ -107,6 +107,16 @@ protected:
                                     const Point p,
                                     const unsigned int matsize);
 
+  /**
+   * Fills \p psi with the spectral polynomial basis function values
+   * at a point (x,y,z), reusing its storage.
+   */
+  static void specpoly(const unsigned int dim,
+                       const Order order,
+                       const Point & p,
+                       const unsigned int matsize,
+                       std::vector<Real> & psi);
+
   bool patch_reuse;
 
 private:
@@ -26,6 +26,8 @@
 
 // C++ includes
 #include <cstddef>
+#include <map>
+#include <utility>
 
 namespace libMesh
 {
@@ -464,6 +466,48 @@ protected:
 
 #endif
 
+  /**
+   * Reference shape function values and derivatives on one element
+   * type, indexed [i][qp] like \p phi, \p dphidxi etc.
+   */
+  struct ReferenceShapes
+  {
+    std::vector<std::vector<OutputShape> > phi;
+    std::vector<std::vector<OutputShape> > dphidxi, dphideta, dphidzeta;
+#ifdef LIBMESH_ENABLE_SECOND_DERIVATIVES
+    std::vector<std::vector<OutputShape> > d2phidxi2, d2phidxideta, d2phideta2,
+      d2phidxidzeta, d2phidetadzeta, d2phidzeta2;
+#endif
+  };
+
+  /**
+   * Swaps the reference values in \p phi, \p dphidxi etc. with those
+   * in \p shapes.
+   */
+  void swap_reference_shapes (ReferenceShapes & shapes);
+
+  /**
+   * Fills \p phi, \p dphidxi etc. at the points \p qp on elements
+   * like \p elem from the shared cache of reference values, adding
+   * them to the cache first if need be.
+   */
+  void copy_cached_reference_shapes (const std::vector<Point> & qp,
+                                     const Elem * elem,
+                                     unsigned int n_shapes);
+
+  /**
+   * The element type and p level the reference values in \p phi etc.
+   * belong to, if \p phi_from_reference_cache.
+   */
+  std::pair<ElemType, unsigned int> reference_shapes_key;
+
+  /**
+   * Reference values taken from the cache for the element types and
+   * p levels we have since moved away from, so that coming back to
+   * one is a swap rather than a copy.
+   */
+  std::map<std::pair<ElemType, unsigned int>, ReferenceShapes> stashed_reference_shapes;
+
   /**
    * An array of the node locations on the last
    * element we computed on
@@ -1047,6 +1091,7 @@ template <unsigned int Dim, FEFamily T>
 inline
 FE<Dim,T>::FE (const FEType & fet) :
   FEGenericBase<typename FEOutputType<T>::type> (Dim,fet),
+  reference_shapes_key(INVALID_ELEM, 0),
   last_side(INVALID_ELEM),
   last_edge(libMesh::invalid_uint)
 {
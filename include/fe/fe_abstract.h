@@ -217,6 +217,16 @@ public:
 
 #endif // LIBMESH_ENABLE_PERIODIC
 
+  /**
+   * \returns \p true if any shape function or mapping data has been
+   * requested from this object through its get_* functions, i.e. if
+   * a reinit() is known to compute something a caller wants.
+   */
+  bool has_requested_data() const
+  { return calculate_phi || calculate_dphi || calculate_d2phi ||
+      calculate_curl_phi || calculate_div_phi || calculate_dphiref ||
+      this->_fe_map->has_requested_data(); }
+
   /**
    * \returns The \p xyz spatial locations of the quadrature
    * points on the element.
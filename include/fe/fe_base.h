@@ -229,6 +229,26 @@ public:
   { libmesh_assert(!calculations_started || calculate_dphi);
     calculate_dphi = calculate_dphiref = true; return dphi; }
 
+  /**
+   * \returns The shape function values at the quadrature points,
+   * stored contiguously with the shape function index running
+   * fastest: \p get_phi_packed()[qp*n_sf + i] == \p get_phi()[i][qp].
+   * This layout lets element kernels (see FEKernels) stream over
+   * the shape functions at each quadrature point with unit stride.
+   */
+  const std::vector<OutputShape> & get_phi_packed() const
+  { libmesh_assert(!calculations_started || calculate_phi_packed);
+    calculate_phi = calculate_phi_packed = true; return phi_packed; }
+
+  /**
+   * \returns The shape function derivatives at the quadrature
+   * points, stored contiguously with the shape function index
+   * running fastest, as in \p get_phi_packed().
+   */
+  const std::vector<OutputGradient> & get_dphi_packed() const
+  { libmesh_assert(!calculations_started || calculate_dphi_packed);
+    calculate_dphi = calculate_dphiref = calculate_dphi_packed = true; return dphi_packed; }
+
   /**
    * \returns The curl of the shape function at the quadrature
    * points.
@@ -442,6 +462,34 @@ public:
 
 #endif
 
+  /**
+   * Evaluates the finite element function with local coefficients
+   * \p coefs at each quadrature point of the current element, and
+   * optionally its gradient.
+   *
+   * On Lagrange quadrilaterals and hexahedra, and on first and
+   * second order hierarchic ones, reinitialized on a
+   * \p QGauss rule this uses sum factorization: the 1D basis is
+   * applied one direction at a time, at O(p^{d+1}) rather than
+   * O(p^{2d}) cost, without reading \p phi or \p dphi; only
+   * \p get_JxW() needs to have been requested before \p reinit().
+   * Other elements fall back on \p phi and \p dphi, which must then
+   * have been requested.
+   */
+  void interpolate (const DenseVector<Number> & coefs,
+                    std::vector<OutputNumber> & values,
+                    std::vector<OutputNumberGradient> * gradients = libmesh_nullptr) const;
+
+  /**
+   * The transpose of \p interpolate(): adds
+   * sum_qp JxW[qp] * (values[qp]*phi[i][qp] + gradients[qp]*dphi[i][qp])
+   * to \p result(i) for every shape function i.  Either \p values
+   * or \p gradients may be \p NULL.  Sum factorization is used
+   * under the same conditions as in \p interpolate().
+   */
+  void integrate (const std::vector<OutputNumber> * values,
+                  const std::vector<OutputNumberGradient> * gradients,
+                  DenseVector<Number> & result) const;
 
   /**
    * Prints the value of each shape function at each quadrature point.
@@ -499,6 +547,14 @@ protected:
    */
   virtual void compute_shape_functions(const Elem * elem, const std::vector<Point> & qp);
 
+  /**
+   * Copies \p phi and \p dphi into the contiguous \p phi_packed and
+   * \p dphi_packed arrays, if those were requested.  Called at the
+   * end of \p compute_shape_functions().  Reference values of
+   * \p phi taken from the cache are only copied once.
+   */
+  void pack_shape_functions();
+
   /**
    * Object that handles computing shape function values, gradients, etc
    * in the physical domain.
@@ -657,6 +713,76 @@ protected:
 
 #endif
 
+  /**
+   * \p true if \p phi was filled with reference element values by
+   * \p init_shape_functions(), so that \p compute_shape_functions()
+   * needn't re-evaluate it on every element.
+   */
+  bool phi_from_reference_cache;
+
+  /**
+   * Should we fill the contiguous copies of phi and dphi?
+   */
+  mutable bool calculate_phi_packed;
+  mutable bool calculate_dphi_packed;
+
+  /**
+   * Shape function values and derivatives with the shape function
+   * index running fastest.
+   */
+  std::vector<OutputShape> phi_packed;
+  std::vector<OutputGradient> dphi_packed;
+
+  /**
+   * \p true if \p phi_packed holds the current \p phi, which
+   * needn't be packed again while \p phi_from_reference_cache.
+   * Reset whenever \p phi is reinitialized.
+   */
+  bool phi_packed_current;
+
+  /**
+   * Sets up the 1D basis used by \p interpolate() and \p integrate()
+   * for the current element and quadrature rule.  \returns \p false
+   * if the current element does not allow sum factorization.
+   */
+  bool init_tensor_product_basis() const;
+
+  /**
+   * The \p interpolate() and \p integrate() implementations that
+   * use \p phi and \p dphi directly.
+   */
+  void interpolate_with_shapes (const DenseVector<Number> & coefs,
+                                std::vector<OutputNumber> & values,
+                                std::vector<OutputNumberGradient> * gradients) const;
+
+  void integrate_with_shapes (const std::vector<OutputNumber> * values,
+                              const std::vector<OutputNumberGradient> * gradients,
+                              DenseVector<Number> & result) const;
+
+  /**
+   * 1D shape function values and derivatives at the 1D quadrature
+   * points, with the quadrature point index running fastest, and the
+   * 1D shape function index in each direction for each shape
+   * function of the element.
+   */
+  mutable std::vector<Real> _tp_phi;
+  mutable std::vector<Real> _tp_dphi;
+  mutable std::vector<unsigned int> _tp_index;
+
+  /**
+   * The number of 1D shape functions and 1D quadrature points.
+   */
+  mutable unsigned int _tp_n_sf;
+  mutable unsigned int _tp_n_qp;
+
+  /**
+   * The element type, order and number of quadrature points the
+   * 1D basis was set up for.
+   */
+  mutable ElemType _tp_elem_type;
+  mutable Order _tp_order;
+  mutable unsigned int _tp_n_points;
+
 private:
 
 #ifdef LIBMESH_ENABLE_INFINITE_ELEMENTS
@@ -720,6 +846,17 @@ FEGenericBase<OutputType>::FEGenericBase(const unsigned int d,
   dweight(),
   weight()
 #endif
+  ,phi_from_reference_cache(false)
+  ,calculate_phi_packed(false)
+  ,calculate_dphi_packed(false)
+  ,phi_packed()
+  ,dphi_packed()
+  ,phi_packed_current(false)
+  ,_tp_n_sf(0)
+  ,_tp_n_qp(0)
+  ,_tp_elem_type(INVALID_ELEM)
+  ,_tp_order(INVALID_ORDER)
+  ,_tp_n_points(0)
 {
 }
 
@@ -25,6 +25,7 @@
 #include "libmesh/enum_elem_type.h"
 #include "libmesh/vector_value.h"
 #include "libmesh/enum_fe_family.h"
+#include "libmesh/fe_type.h"
 
 // C++ includes
 #include <map>
@@ -39,7 +40,6 @@ class BoundaryInfo;
 class DofConstraints;
 class DofMap;
 class Elem;
-class FEType;
 class FEComputeData;
 class Point;
 class MeshBase;
@@ -356,6 +356,85 @@ public:
   static unsigned int n_vec_dim (const MeshBase & mesh,
                                  const FEType & fe_type);
 
+  /**
+   * The static \p FE methods for one dimension and \p FEFamily,
+   * resolved once by \p FEInterface::kernel().  Loops which call
+   * these methods for many elements can hold a \p Kernel and skip
+   * the switch over dimension and family that the corresponding
+   * \p FEInterface methods perform on every call.
+   *
+   * The approximation order is passed on each call, so one \p Kernel
+   * serves p refined elements too.  Infinite elements are still
+   * forwarded to \p InfFE.
+   */
+  class Kernel
+  {
+  public:
+    /**
+     * Constructor.  A default constructed \p Kernel can't be called
+     * until it is assigned one from \p FEInterface::kernel().
+     */
+    Kernel ();
+
+    unsigned int n_dofs (const ElemType t,
+                         const Order o) const;
+
+    unsigned int n_dofs_at_node (const ElemType t,
+                                 const Order o,
+                                 const unsigned int n) const;
+
+    unsigned int n_dofs_per_elem (const ElemType t,
+                                  const Order o) const;
+
+    void dofs_on_side (const Elem * const elem,
+                       const Order o,
+                       unsigned int s,
+                       std::vector<unsigned int> & di) const;
+
+    void dofs_on_edge (const Elem * const elem,
+                       const Order o,
+                       unsigned int e,
+                       std::vector<unsigned int> & di) const;
+
+    /**
+     * Only available for scalar-valued families.
+     */
+    Real shape (const Elem * elem,
+                const Order o,
+                const unsigned int i,
+                const Point & p) const;
+
+  private:
+    friend class FEInterface;
+
+    /**
+     * \returns The stored \p FEType with order \p o, for forwarding
+     * to \p InfFE.
+     */
+    FEType fe_type (const Order o) const;
+
+    unsigned int _dim;
+    FEType _fe_type;
+
+    unsigned int (* _n_dofs) (const ElemType, const Order);
+    unsigned int (* _n_dofs_at_node) (const ElemType, const Order,
+                                      const unsigned int);
+    unsigned int (* _n_dofs_per_elem) (const ElemType, const Order);
+    void (* _dofs_on_side) (const Elem * const, const Order,
+                            unsigned int, std::vector<unsigned int> &);
+    void (* _dofs_on_edge) (const Elem * const, const Order,
+                            unsigned int, std::vector<unsigned int> &);
+    Real (* _shape) (const Elem *, const Order,
+                     const unsigned int, const Point &);
+  };
+
+  /**
+   * \returns The \p Kernel for elements of dimension \p dim and the
+   * family of \p fe_t.
+   */
+  static Kernel kernel (const unsigned int dim,
+                        const FEType & fe_t);
+
 private:
 
 
@@ -365,6 +444,20 @@ private:
    */
   static bool is_InfFE_elem(const ElemType et);
 
+  /**
+   * Helpers for \p kernel(): store the static methods of \p FEClass
+   * in \p k, including \p shape() for the scalar version.
+   */
+  template <typename FEClass>
+  static void set_kernel_methods (Kernel & k);
+
+  template <typename FEClass>
+  static void set_scalar_kernel_methods (Kernel & k);
+
+  template <unsigned int Dim>
+  static void set_kernel_family (Kernel & k,
+                                 const FEFamily family);
+
 
 #ifdef LIBMESH_ENABLE_INFINITE_ELEMENTS
 
@@ -487,6 +580,98 @@ inline bool FEInterface::is_InfFE_elem(const ElemType et)
 
 
 
+inline
+FEInterface::Kernel::Kernel () :
+  _dim (0),
+  _n_dofs (libmesh_nullptr),
+  _n_dofs_at_node (libmesh_nullptr),
+  _n_dofs_per_elem (libmesh_nullptr),
+  _dofs_on_side (libmesh_nullptr),
+  _dofs_on_edge (libmesh_nullptr),
+  _shape (libmesh_nullptr)
+{
+}
+
+
+
+inline
+FEType FEInterface::Kernel::fe_type (const Order o) const
+{
+  FEType fe_t = _fe_type;
+  fe_t.order = o;
+  return fe_t;
+}
+
+
+
+inline
+unsigned int FEInterface::Kernel::n_dofs (const ElemType t,
+                                          const Order o) const
+{
+#ifdef LIBMESH_ENABLE_INFINITE_ELEMENTS
+  if (is_InfFE_elem(t))
+    return ifem_n_dofs(_dim, this->fe_type(o), t);
+#endif
+
+  libmesh_assert(_n_dofs);
+  return _n_dofs(t, o);
+}
+
+
+
+inline
+unsigned int FEInterface::Kernel::n_dofs_at_node (const ElemType t,
+                                                  const Order o,
+                                                  const unsigned int n) const
+{
+#ifdef LIBMESH_ENABLE_INFINITE_ELEMENTS
+  if (is_InfFE_elem(t))
+    return ifem_n_dofs_at_node(_dim, this->fe_type(o), t, n);
+#endif
+
+  libmesh_assert(_n_dofs_at_node);
+  return _n_dofs_at_node(t, o, n);
+}
+
+
+
+inline
+unsigned int FEInterface::Kernel::n_dofs_per_elem (const ElemType t,
+                                                   const Order o) const
+{
+#ifdef LIBMESH_ENABLE_INFINITE_ELEMENTS
+  if (is_InfFE_elem(t))
+    return ifem_n_dofs_per_elem(_dim, this->fe_type(o), t);
+#endif
+
+  libmesh_assert(_n_dofs_per_elem);
+  return _n_dofs_per_elem(t, o);
+}
+
+
+
+inline
+void FEInterface::Kernel::dofs_on_side (const Elem * const elem,
+                                        const Order o,
+                                        unsigned int s,
+                                        std::vector<unsigned int> & di) const
+{
+  libmesh_assert(_dofs_on_side);
+  _dofs_on_side(elem, o, s, di);
+}
+
+
+
+inline
+void FEInterface::Kernel::dofs_on_edge (const Elem * const elem,
+                                        const Order o,
+                                        unsigned int e,
+                                        std::vector<unsigned int> & di) const
+{
+  libmesh_assert(_dofs_on_edge);
+  _dofs_on_edge(elem, o, e, di);
+}
+
 } // namespace libMesh
 
 
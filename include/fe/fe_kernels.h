@@ -0,0 +1,88 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FE_KERNELS_H
+#define LIBMESH_FE_KERNELS_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/vector_value.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+template <typename T> class DenseMatrix;
+
+/**
+ * The \p FEKernels namespace collects element matrix kernels which
+ * operate on the contiguous, shape-function-fastest arrays returned
+ * by \p FEGenericBase::get_phi_packed() and
+ * \p FEGenericBase::get_dphi_packed().  Each quadrature point adds
+ * a rank-one update to \p K, whose innermost loop runs along a row
+ * of \p K and over the shape functions with unit stride, so that it
+ * can be vectorized by the compiler.
+ *
+ * All kernels add into the leading \p n_dofs x \p n_dofs block of
+ * \p K, where \p n_dofs is the number of shape functions implied by
+ * the sizes of the packed arrays and of \p JxW.
+ *
+ * \brief Vectorizable element matrix kernels.
+ */
+namespace FEKernels
+{
+
+/**
+ * Adds the weighted mass matrix
+ * \f$ K_{ij} += c \sum_{qp} JxW_{qp} \phi_i(qp) \phi_j(qp) \f$.
+ */
+void add_mass_matrix (const std::vector<Real> & JxW,
+                      const std::vector<Real> & phi_packed,
+                      DenseMatrix<Number> & K,
+                      const Number c = 1.);
+
+/**
+ * Adds the weighted Laplacian stiffness matrix
+ * \f$ K_{ij} += c \sum_{qp} JxW_{qp} \nabla\phi_i(qp) \cdot \nabla\phi_j(qp) \f$.
+ */
+void add_stiffness_matrix (const std::vector<Real> & JxW,
+                           const std::vector<RealGradient> & dphi_packed,
+                           DenseMatrix<Number> & K,
+                           const Number c = 1.);
+
+/**
+ * Adds the weighted advection matrix
+ * \f$ K_{ij} += c \sum_{qp} JxW_{qp} \phi_i(qp) (\mathbf{u}(qp) \cdot \nabla\phi_j(qp)) \f$,
+ * where \p velocity holds \f$ \mathbf{u} \f$ at each quadrature point.
+ */
+void add_advection_matrix (const std::vector<Real> & JxW,
+                           const std::vector<Real> & phi_packed,
+                           const std::vector<RealGradient> & dphi_packed,
+                           const std::vector<RealGradient> & velocity,
+                           DenseMatrix<Number> & K,
+                           const Number c = 1.);
+
+} // namespace FEKernels
+
+} // namespace libMesh
+
+#endif // LIBMESH_FE_KERNELS_H
@@ -26,6 +26,7 @@
 #include "libmesh/enum_elem_type.h"
 #include "libmesh/fe_type.h"
 #include "libmesh/auto_ptr.h"
+#include "libmesh/point_array.h"
 
 namespace libMesh
 {
@@ -516,6 +517,13 @@ public:
   { libmesh_assert(!calculations_started || calculate_dxyz);
     calculate_dxyz = true; return JxW; }
 
+  /**
+   * \returns \p true if any mapping data has been requested from
+   * this object.
+   */
+  bool has_requested_data() const
+  { return calculate_xyz || calculate_dxyz || calculate_d2xyz; }
+
 protected:
 
   /**
@@ -902,6 +910,44 @@ private:
    */
   void compute_inverse_map_second_derivs(unsigned p);
 
+  /**
+   * A fast path used by FEMap::compute_affine_map() for first-order
+   * elements of dimension \p Dim whose constant map derivatives
+   * \p dxyz have already been computed from node differences.  The
+   * inverse map and Jacobian are computed once and copied to all
+   * quadrature points, skipping the generic sums over mapping shape
+   * functions.  Returns false without setting the map derivative data
+   * if the Jacobian is not positive, in which case the caller should
+   * fall back to the generic code (and its error reporting).
+   */
+  template <unsigned int Dim>
+  bool compute_affine_linear_map(const std::vector<Real> & qw,
+                                 const Elem * elem,
+                                 const RealGradient * dxyz);
+
+#if LIBMESH_DIM == 3
+  /**
+   * Computes the map of a three-dimensional element at all the
+   * quadrature points at once, without second derivatives.  This is
+   * what FEMap::compute_single_point_map() computes, but the sums over
+   * mapping shape functions, the Jacobians and the inverse map are
+   * each done for all the points together, on the structure of
+   * arrays work space below, in loops the compiler can vectorize.
+   */
+  void compute_map_3D (const std::vector<Real> & qw,
+                       const Elem * elem,
+                       const std::vector<const Node *> & nodes);
+
+  /**
+   * Work space for compute_map_3D()
+   */
+  PointArray xyz_array;
+  PointArray dxyzdxi_array;
+  PointArray dxyzdeta_array;
+  PointArray dxyzdzeta_array;
+  PointArray inverse_map_array;
+#endif
+
   /**
    * Work vector for compute_affine_map()
    */
@@ -544,6 +544,11 @@ protected:
    * changes.  Afterwards, the fields are ready to be used
    * to compute global derivatives, the jacobian etc, see
    * \p FEAbstract::compute_map().
+   *
+   * The base-times-radial products in \p phi, \p dphidxi etc.
+   * and in the mapping shape functions do not depend on the
+   * geometry, so they are only recomputed after the radial or
+   * base shapes have been re-initialized.
    */
   void combine_base_radial(const Elem * inf_elem);
 
@@ -737,6 +742,13 @@ protected:
    */
   std::vector<Real> _total_qrule_weights;
 
+  /**
+   * \p true while \p phi, \p dphidxi, \p dphideta, \p dphidzeta and
+   * the mapping shape functions hold the products of the current
+   * base and radial shapes.
+   */
+  bool _shape_products_valid;
+
   /**
    * The quadrature rule for the base element associated
    * with the current infinite element
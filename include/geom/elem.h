@@ -35,6 +35,7 @@
 #include "libmesh/multi_predicates.h"
 #include "libmesh/variant_filter_iterator.h"
 #include "libmesh/hashword.h" // Used in compute_key() functions
+#include "libmesh/slab_pool.h"
 
 // C++ includes
 #include <algorithm>
@@ -107,6 +108,19 @@ public:
    */
   virtual ~Elem();
 
+  /**
+   * Elements are allocated from slab pools, one per object size (and
+   * so roughly one per \p ElemType), rather than one at a time from
+   * the heap.  Deleting an element returns its memory to the pool;
+   * \p SlabPool::release_unused_pooled_memory() returns empty slabs
+   * to the system.
+   */
+  static void * operator new (std::size_t size)
+  { return SlabPool::pooled_allocate(size); }
+
+  static void operator delete (void * p, std::size_t size)
+  { SlabPool::pooled_deallocate(p, size); }
+
   /**
    * \returns The \p Point associated with local \p Node \p i.
    */
@@ -406,6 +420,14 @@ public:
   void find_point_neighbors(const Point & p,
                             std::set<const Elem *> & neighbor_set) const;
 
+  /**
+   * Same as the \p find_point_neighbors() member above, but fills a
+   * caller-provided vector (sorted, without duplicates) whose storage
+   * can be reused from call to call.
+   */
+  void find_point_neighbors(const Point & p,
+                            std::vector<const Elem *> & neighbors) const;
+
   /**
    * This function finds all active elements (including this one) in
    * the same manifold as this element which touch this active element
@@ -413,6 +435,11 @@ public:
    */
   void find_point_neighbors(std::set<const Elem *> & neighbor_set) const;
 
+  /**
+   * Vector version of the \p find_point_neighbors() member above.
+   */
+  void find_point_neighbors(std::vector<const Elem *> & neighbors) const;
+
   /**
    * This function finds all active elements (including this one) in
    * the same manifold as start_elem (which must be active and must
@@ -421,6 +448,12 @@ public:
   void find_point_neighbors(std::set<const Elem *> & neighbor_set,
                             const Elem * start_elem) const;
 
+  /**
+   * Vector version of the \p find_point_neighbors() member above.
+   */
+  void find_point_neighbors(std::vector<const Elem *> & neighbors,
+                            const Elem * start_elem) const;
+
   /**
    * This function finds all active elements in the same manifold as
    * this element which touch the current active element along the
@@ -430,6 +463,13 @@ public:
                            const Point & p2,
                            std::set<const Elem *> & neighbor_set) const;
 
+  /**
+   * Vector version of the \p find_edge_neighbors() member above.
+   */
+  void find_edge_neighbors(const Point & p1,
+                           const Point & p2,
+                           std::vector<const Elem *> & neighbors) const;
+
   /**
    * This function finds all active elements in the same manifold as
    * this element which touch the current active element along any
@@ -440,6 +480,11 @@ public:
    */
   void find_edge_neighbors(std::set<const Elem *> & neighbor_set) const;
 
+  /**
+   * Vector version of the \p find_edge_neighbors() member above.
+   */
+  void find_edge_neighbors(std::vector<const Elem *> & neighbors) const;
+
   /**
    * This function finds all active elements (*not* including this
    * one) in the parent manifold of this element whose intersection
@@ -447,6 +492,11 @@ public:
    */
   void find_interior_neighbors(std::set<const Elem *> & neighbor_set) const;
 
+  /**
+   * Vector version of the \p find_interior_neighbors() member above.
+   */
+  void find_interior_neighbors(std::vector<const Elem *> & neighbors) const;
+
   /**
    * Resets this element's neighbors' appropriate neighbor pointers
    * and its parent's and children's appropriate pointers
@@ -1513,23 +1563,9 @@ public:
 
 protected:
 
-  /**
-   * Pointers to the nodes we are connected to.
-   */
-  Node ** _nodes;
-
-  /**
-   * Pointers to this element's parent and neighbors, and for
-   * lower-dimensional elements' interior_parent.
-   */
-  Elem ** _elemlinks;
-
-#ifdef LIBMESH_ENABLE_AMR
-  /**
-   * Pointers to this element's children.
-   */
-  Elem ** _children;
-#endif
+  // The small data members come first, so that they can share the
+  // tail padding of the DofObject base instead of taking up another
+  // word after the pointers below.
 
   /**
    * The subdomain to which this element belongs.
@@ -1554,11 +1590,27 @@ protected:
    * polynomial degree on this element and the minimum
    * polynomial degree on the mesh.
    * This is stored as an unsigned char to save space.
-   * In theory, these last four bytes might have
-   * been padding anyway.
    */
   unsigned char _p_level;
 #endif
+
+  /**
+   * Pointers to the nodes we are connected to.
+   */
+  Node ** _nodes;
+
+  /**
+   * Pointers to this element's parent and neighbors, and for
+   * lower-dimensional elements' interior_parent.
+   */
+  Elem ** _elemlinks;
+
+#ifdef LIBMESH_ENABLE_AMR
+  /**
+   * Pointers to this element's children.
+   */
+  Elem ** _children;
+#endif
 };
 
 
@@ -1582,17 +1634,17 @@ Elem::Elem(const unsigned int nn,
            Elem * p,
            Elem ** elemlinkdata,
            Node ** nodelinkdata) :
-  _nodes(nodelinkdata),
-  _elemlinks(elemlinkdata),
+  _sbd_id(0),
 #ifdef LIBMESH_ENABLE_AMR
-  _children(libmesh_nullptr),
+  _rflag(Elem::DO_NOTHING),
+  _pflag(Elem::DO_NOTHING),
+  _p_level(0),
 #endif
-  _sbd_id(0)
+  _nodes(nodelinkdata),
+  _elemlinks(elemlinkdata)
 #ifdef LIBMESH_ENABLE_AMR
   ,
-  _rflag(Elem::DO_NOTHING),
-  _pflag(Elem::DO_NOTHING),
-  _p_level(0)
+  _children(libmesh_nullptr)
 #endif
 {
   this->processor_id() = DofObject::invalid_processor_id;
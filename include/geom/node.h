@@ -25,6 +25,7 @@
 #include "libmesh/dof_object.h"
 #include "libmesh/reference_counted_object.h"
 #include "libmesh/auto_ptr.h"
+#include "libmesh/slab_pool.h"
 
 // C++ includes
 #include <iostream>
@@ -82,6 +83,16 @@ public:
    */
   ~Node ();
 
+  /**
+   * Nodes are allocated from a slab pool rather than one at a time
+   * from the heap; see \p Elem::operator new.
+   */
+  static void * operator new (std::size_t size)
+  { return SlabPool::pooled_allocate(size); }
+
+  static void operator delete (void * p, std::size_t size)
+  { SlabPool::pooled_deallocate(p, size); }
+
   /**
    * Assign to a node from a point.
    */
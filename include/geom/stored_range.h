@@ -115,6 +115,24 @@ public:
   {
   }
 
+  /**
+   * Constructor.  Takes a std::vector of objects which the range
+   * will only read, such as the cached element lists of MeshBase.
+   * The vector MUST live for the lifetime of this StoredRange, and
+   * reset(first,last) must not be called on it.
+   */
+  StoredRange (const std::vector<object_type> * objs,
+               const unsigned int new_grainsize = 1000) :
+    _end(objs->end()),
+    _begin(objs->begin()),
+    _last(objs->size()),
+    _first(0),
+    _grainsize(new_grainsize),
+    _objs(const_cast<std::vector<object_type> *>(objs)),
+    _should_release(false)
+  {
+  }
+
   /**
    * Copy constructor.  The \p StoredRange can be copied into
    * subranges for parallel execution.  In this way the
@@ -22,9 +22,9 @@
 // Local includes
 #include "libmesh/libmesh_common.h"
 #include "libmesh/mesh_input.h"
+#include "libmesh/text_scanner.h"
 
 // C++ includes
-#include <fstream>
 #include <set>
 
 namespace libMesh
@@ -199,9 +199,10 @@ private:
   sideset_container_t _sideset_ids;
 
   /**
-   * Stream object used to interact with the file
+   * Scanner over the contents of the file, which is mapped into
+   * memory while it is read.
    */
-  std::ifstream _in;
+  TextScanner _in;
 
   /**
    * A set of the different geometric element types detected when reading the
@@ -24,6 +24,7 @@
 #include "libmesh/libmesh_common.h"
 #include "libmesh/id_types.h"
 #include "libmesh/parallel_object.h"
+#include "libmesh/flat_multimap.h"
 
 // C++ includes
 #include <cstddef>
@@ -133,6 +134,25 @@ public:
              UnstructuredMesh & boundary_mesh,
              const std::set<subdomain_id_type> & subdomains_relative_to);
 
+  /**
+   * Like the sync() above, but also returns the correspondence
+   * between \p boundary_mesh and this mesh, as it is known while the
+   * boundary mesh is built, so that no geometric search is needed
+   * afterwards:
+   *  - \p node_id_map maps the ids of interior nodes to the ids of the
+   *    corresponding \p boundary_mesh nodes.
+   *  - \p side_id_map maps the ids of \p boundary_mesh elements to the
+   *    side of their interior_parent() they were built from.
+   * These are the maps get_side_and_node_maps() computes, restricted
+   * to the objects this processor has.  The boundary mesh may be
+   * distributed, in which case the interior mesh is not serialized.
+   */
+  void sync (const std::set<boundary_id_type> & requested_boundary_ids,
+             UnstructuredMesh & boundary_mesh,
+             const std::set<subdomain_id_type> & subdomains_relative_to,
+             std::map<dof_id_type, dof_id_type> & node_id_map,
+             std::map<dof_id_type, unsigned char> & side_id_map);
+
   /**
    * Suppose we have used sync to create \p boundary_mesh. Then each
    * element in \p boundary_mesh will have interior_parent defined.
@@ -689,6 +709,34 @@ public:
                              std::vector<unsigned short int> & shellface_list,
                              std::vector<boundary_id_type> &   bc_id_list) const;
 
+  /**
+   * Fills \p elems with the elements which have a side, edge or
+   * shellface id in \p ids, and \p nodes with the nodes which have a
+   * node id in \p ids, both sorted by address for use with
+   * std::binary_search.  This is one pass over each flat id map,
+   * which lets e.g. Dirichlet constraint setup skip elements that
+   * touch none of the requested boundaries.
+   *
+   * Ids on sides, edges and shellfaces are stored on ancestor
+   * elements, so active elements should be looked up along with
+   * their parents.
+   */
+  void build_boundary_entity_lists (const std::set<boundary_id_type> & ids,
+                                    std::vector<const Elem *> & elems,
+                                    std::vector<const Node *> & nodes) const;
+
+  /**
+   * Fills \p elems, sorted by address, with the active elements
+   * which have a side, edge or shellface id in \p ids either
+   * themselves or through an ancestor.  Ancestors contribute all
+   * their active descendants, so this may be a superset of the
+   * elements actually on those boundaries; but it lets boundary
+   * loops visit a small list rather than every element of the mesh.
+   * Node ids are not considered.
+   */
+  void build_active_boundary_elem_list (const std::set<boundary_id_type> & ids,
+                                        std::vector<const Elem *> & elems) const;
+
   /**
    * \returns A set of the boundary ids which exist on semilocal parts
    * of the mesh.
@@ -796,6 +844,26 @@ public:
 
 private:
 
+  /**
+   * Implementation of sync().  The maps are filled if they are not
+   * NULL.
+   */
+  void _sync (const std::set<boundary_id_type> & requested_boundary_ids,
+              UnstructuredMesh & boundary_mesh,
+              const std::set<subdomain_id_type> & subdomains_relative_to,
+              std::map<dof_id_type, dof_id_type> * node_id_map,
+              std::map<dof_id_type, unsigned char> * side_id_map);
+
+  /**
+   * Implementation of add_elements().  If \p side_id_map is not
+   * NULL, it is filled with the boundary mesh id given to each
+   * (interior element id, side) pair.
+   */
+  void _add_elements (const std::set<boundary_id_type> & requested_boundary_ids,
+                      UnstructuredMesh & boundary_mesh,
+                      const std::set<subdomain_id_type> & subdomains_relative_to,
+                      std::map<std::pair<dof_id_type, unsigned char>, dof_id_type> * side_id_map);
+
   /**
    * Helper method for finding consistent maps of interior to boundary
    * dof_object ids.  Either node_id_map or side_id_map can be NULL,
@@ -817,47 +885,46 @@ private:
    * Data structure that maps nodes in the mesh
    * to boundary ids.
    */
-  std::multimap<const Node *,
+  flat_multimap<const Node *,
                 boundary_id_type> _boundary_node_id;
 
   /**
    * Typdef for iterators into the _boundary_node_id container.
    */
-  typedef std::multimap<const Node *, boundary_id_type>::const_iterator boundary_node_iter;
+  typedef flat_multimap<const Node *, boundary_id_type>::const_iterator boundary_node_iter;
 
   /**
-   * Some older compilers don't support erasing from a map with
-   * const_iterators, so we need to use a non-const iterator in those
-   * situations.
+   * Iterators into a \p flat_multimap can be used to erase entries
+   * too; these typedefs are kept for the erasure loops.
    */
-  typedef std::multimap<const Node *, boundary_id_type>::iterator boundary_node_erase_iter;
+  typedef flat_multimap<const Node *, boundary_id_type>::iterator boundary_node_erase_iter;
 
   /**
    * Data structure that maps edges of elements
    * to boundary ids. This is only relevant in 3D.
    */
-  std::multimap<const Elem *,
+  flat_multimap<const Elem *,
                 std::pair<unsigned short int, boundary_id_type> >
   _boundary_edge_id;
 
   /**
    * Typdef for iterators into the _boundary_edge_id container.
    */
-  typedef std::multimap<const Elem *,
+  typedef flat_multimap<const Elem *,
                         std::pair<unsigned short int, boundary_id_type> >::const_iterator boundary_edge_iter;
 
   /**
    * Data structure that maps faces of shell elements
    * to boundary ids. This is only relevant for shell elements.
    */
-  std::multimap<const Elem *,
+  flat_multimap<const Elem *,
                 std::pair<unsigned short int, boundary_id_type> >
   _boundary_shellface_id;
 
   /**
    * Typdef for iterators into the _boundary_shellface_id container.
    */
-  typedef std::multimap<const Elem *,
+  typedef flat_multimap<const Elem *,
                         std::pair<unsigned short int, boundary_id_type> >::const_iterator boundary_shellface_iter;
 
 
@@ -865,22 +932,20 @@ private:
    * Data structure that maps sides of elements
    * to boundary ids.
    */
-  std::multimap<const Elem *,
+  flat_multimap<const Elem *,
                 std::pair<unsigned short int, boundary_id_type> >
   _boundary_side_id;
 
   /**
    * Typdef for iterators into the _boundary_side_id container.
    */
-  typedef std::multimap<const Elem *,
+  typedef flat_multimap<const Elem *,
                         std::pair<unsigned short int, boundary_id_type> >::const_iterator boundary_side_iter;
 
   /**
-   * Some older compilers don't support erasing from a map with
-   * const_iterators, so we need to use a non-const iterator in those
-   * situations.
+   * Iterator for the erasure loops over the element containers.
    */
-  typedef std::multimap<const Elem *,
+  typedef flat_multimap<const Elem *,
                         std::pair<unsigned short int, boundary_id_type> >::iterator erase_iter;
   /**
    * A collection of user-specified boundary ids for sides, edges, nodes,
@@ -105,6 +105,27 @@ public:
   bool   parallel() const { return _parallel; }
   bool & parallel()       { return _parallel; }
 
+  /**
+   * Get/Set the flag indicating if we should write partitions in the
+   * raw layout: naturally aligned, little-endian arrays which are
+   * memory-mapped and used in place when read back, rather than
+   * parsed value by value.  The header records which layout was
+   * written, so this only matters when writing.
+   */
+  bool   raw() const { return _raw; }
+  bool & raw()       { return _raw; }
+
+  /**
+   * Get/Set the number of files a parallel checkpoint is aggregated
+   * into.  The default, 0, writes one file per partition.  Otherwise
+   * the partitions are written with collective MPI-IO writes into
+   * this many files (at most one per processor), and the header
+   * records where each partition lies, so that the checkpoint can be
+   * read back on any number of processors.
+   */
+  unsigned int   n_aggregate_files() const { return _n_aggregate_files; }
+  unsigned int & n_aggregate_files()       { return _n_aggregate_files; }
+
   /**
    * Get/Set the version string.
    */
@@ -141,6 +162,45 @@ private:
   //---------------------------------------------------------------------------
   // Write Implementation
 
+  /**
+   * Find the elements and nodes which are written for partition \p pid
+   */
+  void select_piece (processor_id_type pid,
+                     std::set<const Elem *, CompareElemIdsByLevel> & elements,
+                     std::set<const Node *> & connected_nodes) const;
+
+  /**
+   * Write the nodes, elements and boundary information of partition
+   * \p pid
+   */
+  void write_piece (Xdr & io, processor_id_type pid) const;
+
+  /**
+   * Write partition \p pid into \p buffer in the raw layout
+   */
+  void write_raw_piece (std::vector<char> & buffer, processor_id_type pid) const;
+
+  /**
+   * Encode the partitions \p ids into \p data, and build the table
+   * of (partition, file, offset, size) quadruples describing the
+   * partitions written by every processor.  Also computes the file
+   * this processor writes to and where its data starts.
+   */
+  void pack_aggregated_pieces (const std::vector<processor_id_type> & ids,
+                               std::vector<char> & data,
+                               std::vector<xdr_id_type> & table,
+                               unsigned int & my_file,
+                               xdr_id_type & my_offset) const;
+
+  /**
+   * Write \p data at \p offset in aggregated file \p file, collectively
+   * with the other processors sharing that file.
+   */
+  void write_aggregated_file (const std::string & name,
+                              const std::vector<char> & data,
+                              unsigned int file,
+                              xdr_id_type offset) const;
+
   /**
    * Write subdomain name information - NEW in 0.9.2 format
    */
@@ -184,6 +244,36 @@ private:
 
   //---------------------------------------------------------------------------
   // Read Implementation
+
+  /**
+   * Read the nodes, elements and boundary information of one partition
+   */
+  void read_piece (Xdr & io);
+
+  /**
+   * Read one partition in the raw layout from the \p size bytes at \p data
+   */
+  void read_raw_piece (const char * data, std::size_t size);
+
+  /**
+   * Add a node read from a checkpoint to the mesh, or check it
+   * against the copy we already have
+   */
+  void add_node (largest_id_type id, largest_id_type pid,
+                 largest_id_type unique_id, const Point & p);
+
+  /**
+   * Add an element read from a checkpoint to the mesh, or check it
+   * against the copy we already have.
+   *
+   * \returns The dimension of the new element, or 0 if we already
+   * had it.
+   */
+  unsigned int add_elem (largest_id_type id, largest_id_type type,
+                         largest_id_type pid, largest_id_type subdomain_id,
+                         Elem * parent, largest_id_type unique_id,
+                         unsigned int p_level,
+                         const std::vector<largest_id_type> & conn_data);
   /**
    * Read subdomain name information - NEW in 0.9.2 format
    */
@@ -230,6 +320,8 @@ private:
 
   bool _binary;
   bool _parallel;
+  bool _raw;
+  unsigned int _n_aggregate_files;
   std::string _version;
   unsigned int _mesh_dimension;
 
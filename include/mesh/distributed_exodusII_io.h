@@ -0,0 +1,241 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_DISTRIBUTED_EXODUSII_IO_H
+#define LIBMESH_DISTRIBUTED_EXODUSII_IO_H
+
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/auto_ptr.h"
+#include "libmesh/mesh_input.h"
+#include "libmesh/mesh_output.h"
+#include "libmesh/parallel_object.h"
+
+// C++ includes
+#include <map>
+#include <string>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class EquationSystems;
+class ExodusII_IO_Helper;
+class MeshBase;
+class Node;
+
+/**
+ * The \p DistributedExodusII_IO class reads and writes a single
+ * ExodusII file to and from a mesh which may be distributed, without
+ * ever serializing it.
+ *
+ * When writing, every processor numbers and packs its own local
+ * nodes, and its own active elements block by block.  Processor 0
+ * owns the file and writes each processor's piece in turn at its
+ * offset in the global arrays, so no processor needs more than the
+ * largest single piece in memory at once.  Nodal solutions are taken
+ * from the parallel solution vector without localizing all of it.
+ *
+ * When reading, every processor opens the file and reads only its
+ * own slab of the element and node arrays; see read().
+ *
+ * Element and edge data are not supported; use ExodusII_IO for those.
+ */
+class DistributedExodusII_IO : public MeshInput<MeshBase>,
+                               public MeshOutput<MeshBase>,
+                               public ParallelObject
+{
+public:
+
+  /**
+   * Constructor.  Takes a writeable reference to a mesh object, which
+   * can be read into or written.
+   */
+  explicit
+  DistributedExodusII_IO (MeshBase & mesh,
+                          bool single_precision=false);
+
+  /**
+   * Constructor.  Takes a reference to a constant mesh object, which
+   * is written as it is partitioned.
+   */
+  explicit
+  DistributedExodusII_IO (const MeshBase & mesh,
+                          bool single_precision=false);
+
+  /**
+   * Destructor.
+   */
+  virtual ~DistributedExodusII_IO ();
+
+  /**
+   * Reads the ExodusII file \p fname into a distributed mesh, which
+   * is never held in full by any one processor.
+   *
+   * Each processor reads one contiguous slab of the file's elements,
+   * and one of its nodes, by partial (hyperslab) reads.  The nodes of
+   * each slab's elements are fetched from the processors which read
+   * them, and sidesets and nodesets are read in slabs too and sent to
+   * the processors holding their elements and nodes.  The slabs then
+   * make up a valid distributed mesh, which is repartitioned along
+   * the Hilbert curve through the element centroids with a
+   * DistributedHilbertPartitioner (when libHilbert is available) and
+   * redistributed accordingly.  Node and element ids are those the
+   * serial ExodusII_IO reader would assign.
+   *
+   * A replicated mesh is simply read on processor 0 and broadcast.
+   * This function must be called on all processors.
+   */
+  virtual void read (const std::string & fname) libmesh_override;
+
+  /**
+   * This method implements writing a mesh to a specified file.
+   */
+  virtual void write (const std::string & fname) libmesh_override;
+
+  /**
+   * Writes out the solution at a specific timestep.
+   *
+   * \param fname Name of the file to write to
+   * \param es EquationSystems object which contains the solution vector.
+   * \param timestep The timestep to write out, should be _1_ indexed.
+   * \param time The current simulation time.
+   */
+  void write_timestep (const std::string & fname,
+                       const EquationSystems & es,
+                       const int timestep,
+                       const Real time);
+
+  /**
+   * Write out a nodal solution from a type=PARALLEL vector in the
+   * node-major order built by
+   * EquationSystems::build_parallel_solution_vector().
+   */
+  virtual void write_nodal_data (const std::string & fname,
+                                 const NumericVector<Number> & parallel_soln,
+                                 const std::vector<std::string> & names) libmesh_override;
+
+  /**
+   * Write out a nodal solution from a serialized vector.  Each
+   * processor only reads the entries for its own nodes.
+   */
+  virtual void write_nodal_data (const std::string & fname,
+                                 const std::vector<Number> & soln,
+                                 const std::vector<std::string> & names) libmesh_override;
+
+  /**
+   * Write out global variables.  Only processor 0's values are used.
+   */
+  void write_global_data (const std::vector<Number> &,
+                          const std::vector<std::string> &);
+
+  /**
+   * Write out information records.  Only processor 0's records are
+   * used.
+   */
+  void write_information_records (const std::vector<std::string> &);
+
+  /**
+   * Set the flag indicating if we should be verbose.
+   */
+  void verbose (bool set_verbosity);
+
+private:
+
+  /**
+   * Creates the file \p fname and writes the mesh and the nodal
+   * variable \p names to it, the first time it is called.
+   */
+  void write_mesh (const std::string & fname,
+                   const std::vector<std::string> & names);
+
+  /**
+   * Numbers the local nodes, and fills \p node_numbers with the
+   * 1-based Exodus numbers of those nodes and of the ghost nodes of
+   * local elements.
+   */
+  void number_nodes (std::map<dof_id_type, int> & node_numbers);
+
+  /**
+   * Writes the coordinates and node number map of every processor's
+   * local nodes.
+   */
+  void write_nodal_coordinates ();
+
+  /**
+   * Writes the element blocks, with every processor's active local
+   * elements, and fills \p elem_numbers with the 1-based Exodus
+   * numbers of this processor's elements.
+   */
+  void write_elements (const std::map<dof_id_type, int> & node_numbers,
+                       std::map<const Elem *, int> & elem_numbers);
+
+  /**
+   * Writes the sidesets of every processor's active local elements,
+   * followed by the nodesets of every processor's local nodes.
+   */
+  void write_sidesets (const std::map<const Elem *, int> & elem_numbers);
+  void write_nodesets ();
+
+  /**
+   * Writes \p values, this processor's entries of nodal variable \p
+   * var_id at the current timestep.
+   */
+  void write_nodal_values (const std::vector<Real> & values, int var_id);
+
+#ifdef LIBMESH_HAVE_EXODUS_API
+  /**
+   * Processor 0 uses the helper to manage the file.
+   */
+  UniquePtr<ExodusII_IO_Helper> exio_helper;
+#endif
+
+  /**
+   * The file the mesh has been written to, if any.
+   */
+  std::string _current_filename;
+
+  /**
+   * Stores the current value of the timestep when calling
+   * write_timestep().
+   */
+  int _timestep;
+
+  bool _verbose;
+
+  bool _single_precision;
+
+  /**
+   * The local nodes, in the order they are written.
+   */
+  std::vector<const Node *> _local_nodes;
+
+  /**
+   * The 0-based Exodus number of the first node of each processor,
+   * and the total number of nodes at the end.
+   */
+  std::vector<int> _node_offsets;
+};
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_DISTRIBUTED_EXODUSII_IO_H
@@ -243,6 +243,18 @@ public:
    */
   void append(bool val);
 
+  /**
+   * If true, the ExodusII_IO object writes timesteps on a background
+   * thread, so the caller can carry on computing while they reach
+   * the disk.  The solution is still gathered by the calling thread;
+   * only the file writes are deferred.  At most \p max_queued_steps
+   * timesteps wait to be written before write_timestep() blocks.
+   * NetCDF is not thread safe, so every ExodusII_IO and Nemesis_IO
+   * object in the process queues its writes on the same thread.
+   * Without pthreads the writes are made synchronously.
+   */
+  void write_asynchronously(bool val, unsigned int max_queued_steps = 2);
+
   /**
    * Return list of the elemental variable names
    */
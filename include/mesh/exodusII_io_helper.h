@@ -71,6 +71,7 @@ namespace libMesh
 
 // Forward declarations
 class MeshBase;
+class BackgroundWriter;
 
 /**
  * This is the \p ExodusII_IO_Helper class.  This class hides the
@@ -329,6 +330,27 @@ public:
    */
   void write_global_values(const std::vector<Real> & values, int timestep);
 
+  /**
+   * Hands the file writes of write_timestep() and
+   * write_nodal_values() to a background thread, so that the caller
+   * can carry on computing while they reach the disk.  At most \p
+   * max_queued_steps timesteps' worth of writes wait before the
+   * caller blocks; 0 writes synchronously again.
+   *
+   * NetCDF and HDF5 are not thread safe, so the writes of every
+   * helper in the process share a single background thread, and the
+   * helpers' other reads and writes wait for all queued writes to
+   * finish first.
+   */
+  void write_asynchronously(unsigned int max_queued_steps);
+
+  /**
+   * Blocks until every queued background write, of any helper, has
+   * been done.  Code which calls the Exodus API directly has to call
+   * this first, since the background thread may be inside NetCDF.
+   */
+  static void finish_writes();
+
   /**
    * Sets the underlying value of the boolean flag
    * _use_mesh_dimension_instead_of_spatial_dimension.  By default,
@@ -626,6 +648,34 @@ private:
   void write_var_names_impl(const char * var_type,
                             int & count,
                             std::vector<std::string> & names);
+
+  /**
+   * The file writes of write_timestep() and write_nodal_values(),
+   * which may run on the background writer thread.
+   */
+  void write_timestep_now(int timestep, Real time);
+  void write_nodal_values_now(int var_id, const std::vector<Real> & values, int timestep);
+
+  /**
+   * Queued versions of the above, which own copies of their data.
+   */
+  class TimestepJob;
+  class NodalValuesJob;
+
+  /**
+   * \returns The background writer shared by every helper, started
+   * on first use.
+   */
+  static BackgroundWriter & background_writer();
+
+  /**
+   * \returns The number of this helper's writes allowed to wait.
+   */
+  unsigned int max_queued_jobs() const;
+
+  // The number of timesteps allowed to wait for the background
+  // writer, or 0 to write synchronously
+  unsigned int _max_queued_steps;
 };
 
 
@@ -75,6 +75,24 @@ public:
    */
   virtual void read (const std::string & name) libmesh_override;
 
+  /**
+   * Reads the Gmsh *.msh file given by name into a distributed mesh,
+   * which is never held in full by any one processor.
+   *
+   * Processor 0 parses the file \p chunk_size entries at a time and
+   * hands each node and element to a home processor as it goes.
+   * Elements are then sent to the processor which owns their piece
+   * of a space filling curve through the element centroids, and
+   * boundary conditions given by lower-dimensional elements are
+   * matched to the sides they cover without a serial pass.  Node and
+   * element ids are those the serial reader would assign.
+   *
+   * A replicated mesh is simply read on processor 0 and broadcast.
+   * This function must be called on all processors.
+   */
+  void read_distributed (const std::string & name,
+                         dof_id_type chunk_size = 65536);
+
   /**
    * This method implements writing a mesh to a specified file
    * in the Gmsh *.msh format.
@@ -121,6 +139,17 @@ private:
    */
   void read_mesh (std::istream & in);
 
+  /**
+   * Reads the element numbered \p iel from one line of the
+   * $Elements section and appends it to \p record as
+   * [iel, libMesh type, dim, physical, nnodes, node ids...], with
+   * the Gmsh node ids put in libMesh order.
+   */
+  static void read_element_record (std::istream & in,
+                                   Real version,
+                                   dof_id_type iel,
+                                   std::vector<dof_id_type> & record);
+
   /**
    * This method implements writing a mesh to a
    * specified file.  This will write an ASCII *.msh file.
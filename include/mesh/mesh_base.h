@@ -30,10 +30,13 @@
 #include "libmesh/point_locator_base.h"
 #include "libmesh/variant_filter_iterator.h"
 #include "libmesh/parallel_object.h"
+#include "libmesh/point.h"
+#include "libmesh/threads_allocators.h"
 
 // C++ Includes
 #include <cstddef>
 #include <string>
+#include <vector>
 
 namespace libMesh
 {
@@ -42,13 +45,170 @@ namespace libMesh
 class Elem;
 class GhostingFunctor;
 class Node;
-class Point;
 class Partitioner;
 
 template <class MT>
 class MeshInput;
 
 
+/**
+ * Node-to-element adjacency of a mesh in compressed row form: the
+ * elements (active or not) containing the node with id \p i are the
+ * range [elems_begin(i), elems_end(i)).  Built by
+ * MeshBase::node_elem_adjacency().
+ */
+class NodeElemAdjacency
+{
+public:
+  typedef std::vector<const Elem *>::const_iterator const_iterator;
+
+  /**
+   * \returns The number of node ids covered, i.e. the \p
+   * max_node_id() of the mesh this was built from.
+   */
+  dof_id_type n_nodes() const
+  { return _offsets.empty() ? 0 : cast_int<dof_id_type>(_offsets.size() - 1); }
+
+  /**
+   * \returns The number of elements containing node \p node_id.
+   */
+  std::size_t n_elems (dof_id_type node_id) const
+  {
+    libmesh_assert_less (node_id, this->n_nodes());
+    return _offsets[node_id+1] - _offsets[node_id];
+  }
+
+  const_iterator elems_begin (dof_id_type node_id) const
+  {
+    libmesh_assert_less (node_id, this->n_nodes());
+    return _elems.begin() + _offsets[node_id];
+  }
+
+  const_iterator elems_end (dof_id_type node_id) const
+  {
+    libmesh_assert_less (node_id, this->n_nodes());
+    return _elems.begin() + _offsets[node_id+1];
+  }
+
+  /**
+   * Rebuilds the adjacency from every element of \p mesh.
+   */
+  void build (const MeshBase & mesh);
+
+  /**
+   * Releases all memory.
+   */
+  void clear ();
+
+private:
+  std::vector<std::size_t> _offsets;
+  std::vector<const Elem *> _elems;
+};
+
+
+/**
+ * Cached geometric quantities of every element of a mesh, stored as
+ * one array per quantity indexed by element id.  Built by
+ * MeshBase::elem_geometry(), for code which would otherwise call
+ * Elem::volume(), Elem::hmin(), Elem::hmax() or Elem::centroid()
+ * repeatedly on an unchanged mesh.
+ *
+ * For a replicated mesh with MeshBase::share_elem_geometry() set,
+ * the arrays are identical on every processor, so they are stored
+ * once per shared-memory node, in an MPI-3 shared window computed by
+ * the node's first processor and read by the others.
+ */
+class ElemGeometryCache
+{
+public:
+  ElemGeometryCache ();
+
+  ~ElemGeometryCache ();
+
+  /**
+   * \returns The number of element ids covered, i.e. the \p
+   * max_elem_id() of the mesh this was built from.
+   */
+  dof_id_type n_elem() const
+  { return _n_elem; }
+
+  Real volume (const Elem & elem) const
+  { return _data[VOLUME*_n_elem + this->checked_id(elem)]; }
+
+  Real hmin (const Elem & elem) const
+  { return _data[HMIN*_n_elem + this->checked_id(elem)]; }
+
+  Real hmax (const Elem & elem) const
+  { return _data[HMAX*_n_elem + this->checked_id(elem)]; }
+
+  Point centroid (const Elem & elem) const
+  {
+    const dof_id_type id = this->checked_id(elem);
+    Point p;
+    for (unsigned int d=0; d != LIBMESH_DIM; ++d)
+      p(d) = _data[(CENTROID+d)*_n_elem + id];
+    return p;
+  }
+
+  /**
+   * Recomputes the quantities of every element of \p mesh, using
+   * multiple threads if available.  If the cache is shared, this is
+   * collective on the mesh's communicator.
+   */
+  void build (const MeshBase & mesh);
+
+  /**
+   * Releases all memory.  If the cache is shared, this is collective
+   * on the processors of each node.
+   */
+  void clear ();
+
+private:
+  dof_id_type checked_id (const Elem & elem) const;
+
+  /**
+   * The offsets, in units of n_elem(), of each quantity's array
+   */
+  enum Quantity { VOLUME = 0,
+                  HMIN,
+                  HMAX,
+                  CENTROID,
+                  N_QUANTITIES = CENTROID + LIBMESH_DIM };
+
+  /**
+   * Left unwritten by resizing, so that build() can let the threads
+   * computing the entries write them first.
+   */
+  typedef std::vector<Real, Threads::first_touch_allocator<Real> > RealArray;
+
+  dof_id_type _n_elem;
+
+  /**
+   * The storage of an unshared cache.
+   */
+  RealArray _local;
+
+  /**
+   * All quantities, in \p _local or in the shared window.
+   */
+  Real * _data;
+
+#ifdef LIBMESH_HAVE_MPI
+  /**
+   * The shared window holding a shared cache, or MPI_WIN_NULL.
+   */
+  MPI_Win _window;
+#endif
+
+  // The window can't be copied
+  ElemGeometryCache (const ElemGeometryCache &);
+  ElemGeometryCache & operator= (const ElemGeometryCache &);
+
+  friend struct InitElemGeometry;
+  friend struct ComputeElemGeometry;
+};
+
+
 /**
  * This is the \p MeshBase class. This class provides all the data necessary
  * to describe a geometric entity.  It allows for the description of a
@@ -130,6 +290,24 @@ public:
   bool is_prepared () const
   { return _is_prepared; }
 
+  /**
+   * \returns A counter which grows whenever elements or nodes are
+   * added, deleted or renumbered, and whenever the mesh is prepared
+   * for use, repartitioned, cleared or marked as modified, so that
+   * code like IncrementalCheckpoint can tell whether the mesh has
+   * changed since it last looked.
+   */
+  unsigned int revision () const
+  { return _revision; }
+
+  /**
+   * Bumps the revision counter.  Code which changes the mesh without
+   * going through prepare_for_use() afterwards, by moving nodes or
+   * changing boundary ids for example, should call this.
+   */
+  void mark_modified ()
+  { _revision++; }
+
   /**
    * \returns \p true if all elements and nodes of the mesh
    * exist on the current processor, \p false otherwise
@@ -676,6 +854,23 @@ public:
    * elements in the mesh.
    */
   virtual bool contract () = 0;
+
+  /**
+   * Updates neighbor links after the elements in \p refined_elems,
+   * and nothing else, have been refined since they were last found.
+   * The default implementation simply calls \p find_neighbors().
+   */
+  virtual void find_neighbors_after_refinement (const std::vector<Elem *> & refined_elems);
+
+  /**
+   * Tells the next \p prepare_for_use() that the only change to the
+   * mesh since it was last prepared is the refinement of the elements
+   * in \p refined_elems, so that it only needs to update the mesh
+   * near them.  \p MeshRefinement calls this just before it prepares
+   * the mesh; the record is discarded by \p prepare_for_use() and \p
+   * clear().
+   */
+  void record_refined_elements (const std::vector<Elem *> & refined_elems);
 #endif
 
   /**
@@ -692,6 +887,10 @@ public:
    * If this is a distributed mesh, local copies of remote elements
    * will be deleted here - to keep those elements replicated during
    * preparation, set allow_remote_element_removal(false).
+   *
+   * If \p record_refined_elements() was called since the mesh was
+   * last prepared, neighbor links are only updated near the refined
+   * elements and the element dimensions are not recomputed.
    */
   void prepare_for_use (const bool skip_renumber_nodes_and_elements=false, const bool skip_find_neighbors=false);
 
@@ -734,6 +933,16 @@ public:
   void allow_remote_element_removal(bool allow) { _allow_remote_element_removal = allow; }
   bool allow_remote_element_removal() const { return _allow_remote_element_removal; }
 
+  /**
+   * If true is passed in then, on a replicated mesh, the cache built
+   * by elem_geometry() is stored once per shared-memory node rather
+   * than once per processor (this needs MPI-3).  Every processor must
+   * then call elem_geometry() together whenever the cache needs
+   * rebuilding, and clear_elem_geometry() together.
+   */
+  void share_elem_geometry(bool share) { _share_elem_geometry = share; }
+  bool share_elem_geometry() const { return _share_elem_geometry; }
+
   /**
    * If true is passed in then this mesh will no longer be (re)partitioned.
    * It would probably be a bad idea to call this on a Serial Mesh _before_
@@ -749,6 +958,55 @@ public:
   void skip_partitioning(bool skip) { _skip_partitioning = skip; }
   bool skip_partitioning() const { return _skip_partitioning; }
 
+  /**
+   * If true is passed in then renumber_nodes_and_elements() will
+   * also sort the element storage, refinement level by refinement
+   * level, along a Morton (Z-order) curve through the element
+   * centroids before assigning ids.  Since nodes are numbered in
+   * element order, spatially nearby elements and nodes then end up
+   * nearby in memory, which improves cache reuse during assembly.
+   * Has no effect while allow_renumbering() is false.
+   *
+   * Currently only ReplicatedMesh honors this setting.
+   */
+  void allow_spatial_reordering(bool allow) { _allow_spatial_reordering = allow; }
+  bool allow_spatial_reordering() const { return _allow_spatial_reordering; }
+
+  /**
+   * If true is passed in then \p pack_dof_indices() will move the DoF
+   * index buffers of all nodes and elements into a single block owned
+   * by this mesh, leaving each \p DofObject with a pointer into it.
+   * This saves one heap allocation per node and element and keeps
+   * \p dof_number() lookups cache friendly on large meshes.
+   * \p DofMap::distribute_dofs() packs the indices once it has set
+   * them.
+   *
+   * While this is enabled, nodes and elements must not outlive this
+   * mesh or be handed over to another mesh.
+   */
+  void contiguous_dof_indices(bool contiguous);
+  bool contiguous_dof_indices() const { return _contiguous_dof_indices; }
+
+  /**
+   * If true is passed in then \p pack_dof_indices() will also store
+   * the systems, variable groups and component counts of the DoF
+   * index buffers only once for every layout shared by several nodes
+   * or elements, leaving each of them with just its DoF base indices.
+   * When every node carries the same variables this cuts their index
+   * storage by a factor of two or more.  The shared layouts are
+   * copied back out by any change to the number of systems,
+   * variables or components of an object.  Has no effect unless
+   * \p contiguous_dof_indices() is enabled.
+   */
+  void compress_dof_indices(bool compress) { _compress_dof_indices = compress; }
+  bool compress_dof_indices() const { return _compress_dof_indices; }
+
+  /**
+   * Moves the DoF index buffers of all nodes and elements into one
+   * contiguous block, if \p contiguous_dof_indices() is enabled.
+   */
+  void pack_dof_indices();
+
   /**
    * Adds a functor which can specify ghosting requirements for use on
    * distributed meshes.  Multiple ghosting functors can be added; any
@@ -912,6 +1170,81 @@ public:
    */
   void clear_point_locator ();
 
+  /**
+   * \returns The node-to-element adjacency of this mesh, building it
+   * first if the mesh revision() or max_node_id() has changed since
+   * it was last requested.  Like
+   * \p sub_point_locator(), this should not be called from threaded
+   * code unless the adjacency is already up to date.
+   */
+  const NodeElemAdjacency & node_elem_adjacency () const;
+
+  /**
+   * Releases the cached node-to-element adjacency.
+   */
+  void clear_node_elem_adjacency ();
+
+  /**
+   * \returns The cached volume, hmin, hmax and centroid of every
+   * element of this mesh, recomputing them first if the mesh
+   * revision() or max_elem_id() has changed since they were last
+   * requested.  Code which moves nodes must call mark_modified() for
+   * the cache to notice.  This should not be called from threaded
+   * code unless the cache is already up to date.
+   */
+  const ElemGeometryCache & elem_geometry () const;
+
+  /**
+   * Releases the cached element geometry.
+   */
+  void clear_elem_geometry ();
+
+  /**
+   * \returns A contiguous list of the active local elements of this
+   * mesh, in active_local_elements_begin() order, rebuilding it first
+   * if the mesh revision() or max_elem_id() has changed since it was
+   * last requested.  Hot loops can iterate over this, or wrap it in
+   * a ConstElemRange, without the type-erased predicate calls of the
+   * filtered element iterators.  Code which coarsens or repartitions
+   * elements without preparing the mesh must call mark_modified() for
+   * the list to notice.  This should not be
+   * called from threaded code unless the list is already up to date.
+   */
+  const std::vector<const Elem *> & active_local_element_list () const;
+
+  /**
+   * \returns A contiguous list of the active local elements of this
+   * mesh in subdomain \p sid, kept up to date like
+   * active_local_element_list().
+   */
+  const std::vector<const Elem *> &
+  active_local_subdomain_element_list (subdomain_id_type sid) const;
+
+  /**
+   * \returns A contiguous list of the active semilocal elements of
+   * this mesh, kept up to date like active_local_element_list().
+   */
+  const std::vector<const Elem *> & active_semilocal_element_list () const;
+
+  /**
+   * Releases the cached element lists.
+   */
+  void clear_element_lists ();
+
+  /**
+   * Sets the type of the locators built by \p point_locator() and \p
+   * sub_point_locator(), \p TREE_ELEMENTS by default.  A master
+   * locator of another type is released.
+   */
+  void set_point_locator_type (PointLocatorType type);
+
+  /**
+   * \returns The type of the locators built by \p point_locator() and
+   * \p sub_point_locator().
+   */
+  PointLocatorType point_locator_type () const
+  { return _point_locator_type; }
+
   /**
    * In the point locator, do we count lower dimensional elements
    * when we refine point locator regions? This is relevant in
@@ -1304,6 +1637,11 @@ protected:
    */
   bool _is_prepared;
 
+  /**
+   * The mesh revision; see revision().
+   */
+  unsigned int _revision;
+
   /**
    * A \p PointLocator class for this mesh.
    * This will not actually be built unless needed. Further, since we want
@@ -1313,6 +1651,43 @@ protected:
    */
   mutable UniquePtr<PointLocatorBase> _point_locator;
 
+  /**
+   * The type of \p _point_locator and its servants.
+   */
+  PointLocatorType _point_locator_type;
+
+  /**
+   * The cached node-to-element adjacency and the mesh revision it
+   * was built for.
+   */
+  mutable NodeElemAdjacency _node_elem_adjacency;
+  mutable unsigned int _node_elem_adjacency_revision;
+
+  /**
+   * The cached element geometry and the mesh revision it was built
+   * for.
+   */
+  mutable ElemGeometryCache _elem_geometry;
+  mutable unsigned int _elem_geometry_revision;
+
+  /**
+   * The cached active local element lists, overall and by subdomain,
+   * and the mesh revision and max_elem_id() they were built for.
+   */
+  mutable std::vector<const Elem *> _active_local_elem_list;
+  mutable std::map<subdomain_id_type, std::vector<const Elem *> >
+  _active_local_subdomain_elem_lists;
+  mutable unsigned int _active_local_elem_list_revision;
+  mutable dof_id_type _active_local_elem_list_max_id;
+
+  /**
+   * The cached active semilocal element list, and the mesh revision
+   * and max_elem_id() it was built for.
+   */
+  mutable std::vector<const Elem *> _active_semilocal_elem_list;
+  mutable unsigned int _active_semilocal_elem_list_revision;
+  mutable dof_id_type _active_semilocal_elem_list_max_id;
+
   /**
    * Do we count lower dimensional elements in point locator refinement?
    * This is relevant in tree-based point locators, for example.
@@ -1354,6 +1729,49 @@ protected:
    */
   bool _allow_remote_element_removal;
 
+  /**
+   * If this is true then a replicated mesh keeps one copy of its
+   * element geometry cache per shared-memory node.
+   *
+   * This is false by default.
+   */
+  bool _share_elem_geometry;
+
+  /**
+   * If this is true then pack_dof_indices() will move DofObject
+   * indices into _dof_index_arena.
+   */
+  bool _contiguous_dof_indices;
+
+  /**
+   * If this is true then pack_dof_indices() will share the layout of
+   * equally laid out DofObject index buffers.
+   */
+  bool _compress_dof_indices;
+
+  /**
+   * If this is true then renumber_nodes_and_elements() sorts
+   * elements along a space filling curve.
+   */
+  bool _allow_spatial_reordering;
+
+  /**
+   * The packed DoF index buffers of all our nodes and elements, each
+   * stored as its size followed by its entries.
+   */
+  std::vector<dof_id_type> _dof_index_arena;
+
+  /**
+   * If this is true then the only change to the mesh since it was
+   * last prepared has been the refinement of _refined_elements.
+   */
+  bool _only_refined_since_prepared;
+
+  /**
+   * The elements refined since the mesh was last prepared.
+   */
+  std::vector<Elem *> _refined_elements;
+
   /**
    * This structure maintains the mapping of named blocks
    * for file formats that support named blocks.  Currently
@@ -180,6 +180,33 @@ public:
                    DenseVector<Number> & output,
                    const std::set<subdomain_id_type> * subdomain_ids);
 
+  /**
+   * Computes the value of variable 0 at every point in \p p.
+   */
+  virtual void evaluate_batch (const std::vector<Point> & p,
+                               const Real time,
+                               std::vector<Number> & output) libmesh_override;
+
+  /**
+   * Computes the value of the \p i-th requested variable at every
+   * point in \p p.  Runs of consecutive points in the same element
+   * are inverse mapped together and share one dof index lookup.
+   */
+  virtual void component_batch (unsigned int i,
+                                const std::vector<Point> & p,
+                                const Real time,
+                                std::vector<Number> & output) libmesh_override;
+
+  /**
+   * Like above, but restricting the points to the passed
+   * subdomain_ids.
+   */
+  void component_batch (unsigned int i,
+                        const std::vector<Point> & p,
+                        const Real time,
+                        std::vector<Number> & output,
+                        const std::set<subdomain_id_type> * subdomain_ids);
+
   /**
    * Similar to operator() with the same parameter list, but with the difference
    * that multiple values on faces are explicitly permitted. This is useful for
@@ -240,6 +267,32 @@ public:
                 std::vector<Tensor> & output,
                 const std::set<subdomain_id_type> * subdomain_ids = libmesh_nullptr);
 
+  /**
+   * Computes the values, and optionally the gradients and hessians,
+   * of some of the variables at every point in \p p.  \p var_indices
+   * lists the requested variables by their position in the list this
+   * function was constructed with; if it is empty, all of them are
+   * evaluated.  Pass \p libmesh_nullptr for any of \p values, \p
+   * gradients and \p hessians which are not wanted.  Each output is
+   * resized to hold the results for all the requested variables at
+   * the first point, then at the second point, and so on.
+   *
+   * Each point is located only once.  Runs of consecutive points in
+   * the same element are inverse mapped together, and the shape
+   * functions are evaluated there only once for all the requested
+   * variables with the same \p FEType.  Ordering the points by
+   * element therefore saves the most work.
+   *
+   * Points outside the mesh get the out-of-mesh value, which must be
+   * enabled, for their values, gradients and hessians alike.
+   */
+  void evaluate (const std::vector<Point> & p,
+                 const std::vector<unsigned int> & var_indices,
+                 std::vector<Number> * values,
+                 std::vector<Gradient> * gradients,
+                 std::vector<Tensor> * hessians = libmesh_nullptr,
+                 const std::set<subdomain_id_type> * subdomain_ids = libmesh_nullptr);
+
   /**
    * \returns The current \p PointLocator object, for use elsewhere.
    *
@@ -76,6 +76,27 @@ void build_cube (UnstructuredMesh & mesh,
                  const ElemType type=INVALID_ELEM,
                  const bool gauss_lobatto_grid=false);
 
+/**
+ * Builds the same \f$ nx \times ny \times nz \f$ HEX8 cube as \p
+ * build_cube(), but in distributed form: the processors are arranged
+ * in a 3D grid, and each one generates only its own brick of the
+ * structured index space plus one layer of ghost elements, with the
+ * same globally consistent ids every processor would compute.  No
+ * processor ever holds the whole mesh.  The brick decomposition is
+ * kept as the partitioning.
+ *
+ * On a \p ReplicatedMesh, or on a single processor, this simply
+ * calls \p build_cube().
+ */
+void build_distributed_cube (UnstructuredMesh & mesh,
+                             const unsigned int nx,
+                             const unsigned int ny,
+                             const unsigned int nz,
+                             const Real xmin=0., const Real xmax=1.,
+                             const Real ymin=0., const Real ymax=1.,
+                             const Real zmin=0., const Real zmax=1.,
+                             const ElemType type=INVALID_ELEM);
+
 /**
  * A specialized \p build_cube() for 0D meshes.  The resulting
  * mesh is a single NodeElem suitable for ODE tests
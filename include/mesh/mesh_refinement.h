@@ -29,7 +29,8 @@
 // Local Includes
 #include "libmesh/libmesh_common.h"
 #include "libmesh/libmesh.h" // libMesh::invalid_uint
-#include "libmesh/topology_map.h"
+#include "libmesh/point.h"
+#include "libmesh/concurrent_topology_map.h"
 #include "libmesh/parallel_object.h"
 
 // C++ Includes
@@ -40,7 +41,6 @@ namespace libMesh
 
 // Forward Declarations
 class MeshBase;
-class Point;
 class Node;
 class ErrorVector;
 class PeriodicBoundaries;
@@ -520,6 +520,13 @@ private:
    */
   bool _refine_elements ();
 
+  /**
+   * Prepares the mesh for use after \p _coarsen_elements() and/or \p
+   * _refine_elements() have changed it, first letting it know which
+   * elements were refined if nothing else happened.
+   */
+  void prepare_mesh_for_use ();
+
   /**
    * Smooths refinement flags according to current settings.  It is
    * possible that for a given set of refinement flags there is
@@ -726,9 +733,10 @@ private:
                                  const Elem * neighbor);
 
   /**
-   * Data structure that holds the new nodes information.
+   * Data structure that holds the new nodes information.  It is
+   * filled from the existing hierarchy in parallel.
    */
-  TopologyMap _new_nodes_map;
+  ConcurrentTopologyMap _new_nodes_map;
 
   /**
    * Reference to the mesh.
@@ -837,6 +845,42 @@ private:
    */
   bool _enforce_mismatch_limit_prior_to_refinement;
 
+  /**
+   * The elements given new children by \p _refine_elements() since
+   * the mesh was last prepared, and whether that is the only change
+   * to the mesh since then.
+   */
+  std::vector<Elem *> _newly_refined_elements;
+  bool _only_newly_refined;
+
+  /**
+   * Where node \p node of child \p child of an element about to be
+   * refined goes: to node \p parent_node of the element, or, if that
+   * is \p invalid_uint, to a node at \p point between the
+   * \p bracketing_nodes.
+   */
+  struct ChildNode
+  {
+    unsigned int parent_node;
+    std::vector<std::pair<dof_id_type, dof_id_type> > bracketing_nodes;
+    Point point;
+  };
+
+  /**
+   * Fills in the \p ChildNode data of a block of elements, in
+   * parallel.
+   */
+  class ComputeChildNodes;
+
+  /**
+   * The element being refined by \p _refine_elements() and its child
+   * nodes, indexed by child times number of nodes plus node, which
+   * were computed ahead of time so \p add_node() only needs to look
+   * them up.
+   */
+  const Elem * _child_nodes_parent;
+  const std::vector<ChildNode> * _child_nodes;
+
   /**
    * This helper function enforces the desired mismatch limits prior
    * to refinement.  It is called from the
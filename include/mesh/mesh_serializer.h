@@ -20,14 +20,19 @@
 #define LIBMESH_MESH_SERIALIZER_H
 
 // Local includes
+#include "libmesh/enum_elem_type.h"
+#include "libmesh/id_types.h"
+#include "libmesh/point.h"
 
 // C++ includes
-
+#include <vector>
 
 namespace libMesh
 {
 // Forward declarations
 class MeshBase;
+class Elem;
+class Node;
 
 /**
  * Temporarily serialize a DistributedMesh for output; a distributed
@@ -51,6 +56,71 @@ private:
   bool reparallelize;
 };
 
+
+
+
+/**
+ * Streams the nodes and elements of a possibly distributed mesh to
+ * one processor in global id order, in batches of a bounded id
+ * range, so that writers of serial file formats need not gather the
+ * whole mesh with a MeshSerializer.  Each processor contributes the
+ * objects it owns; on a serial mesh the root processor contributes
+ * everything.
+ *
+ * The next_nodes() and next_elems() calls are collective; they fill
+ * their output only on the root processor, and return \p false on
+ * every processor once all ids have been streamed.
+ *
+ * \brief Streams a mesh to one processor in id-ordered batches.
+ */
+class OrderedMeshStream
+{
+public:
+  /**
+   * The data streamed for each element.
+   */
+  struct ElemData
+  {
+    dof_id_type id;
+    ElemType type;
+    subdomain_id_type subdomain_id;
+    bool active;
+    std::vector<dof_id_type> node_ids;
+  };
+
+  OrderedMeshStream(const MeshBase & mesh,
+                    processor_id_type root_id = 0,
+                    dof_id_type batch_size = 65536);
+
+  /**
+   * Streams the next batch of nodes; on the root processor \p ids
+   * and \p points are filled in increasing id order.
+   */
+  bool next_nodes (std::vector<dof_id_type> & ids,
+                   std::vector<Point> & points);
+
+  /**
+   * Streams the next batch of elements, active or not; on the root
+   * processor \p elems is filled in increasing id order.
+   */
+  bool next_elems (std::vector<ElemData> & elems);
+
+private:
+  const MeshBase & _mesh;
+  const processor_id_type _root_id;
+  const dof_id_type _batch_size;
+
+  // The objects this processor contributes, sorted by id, and how
+  // far we have streamed them
+  std::vector<const Node *> _nodes;
+  std::vector<const Elem *> _elems;
+  std::size_t _node_cursor, _elem_cursor;
+
+  // The first id of the next batch, and the end of the id range
+  dof_id_type _next_node_id, _next_elem_id;
+  const dof_id_type _max_node_id, _max_elem_id;
+};
+
 } // namespace libMesh
 
 #endif // LIBMESH_MESH_SERIALIZER_H
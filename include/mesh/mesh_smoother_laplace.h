@@ -30,6 +30,9 @@
 namespace libMesh
 {
 
+// Forward declarations
+class Node;
+
 /**
  * This class defines the data structures necessary
  * for Laplace smoothing.  Note that this is a simple
@@ -68,6 +71,12 @@ public:
    * The actual smoothing function, gets called whenever
    * the user specifies an actual number of smoothing
    * iterations.
+   *
+   * Each iteration is a Jacobi sweep: every movable node is moved to
+   * the average of its neighbors' positions from the previous
+   * iteration, so the sweep is split across threads.  The L-graph is
+   * kept between calls and only rebuilt when the mesh revision
+   * changes.
    */
   void smooth(unsigned int n_iterations);
 
@@ -88,10 +97,29 @@ public:
 
 private:
   /**
-   * This function allgather's the (local) graph after
+   * This function allgather's the (local) \p graph after
    * it is computed on each processor by the init() function.
    */
-  void allgather_graph();
+  void allgather_graph(std::vector<std::vector<dof_id_type> > & graph) const;
+
+  /**
+   * Copies the coordinates of every node we can see into \p coords,
+   * one contiguous array per direction indexed by node id.
+   */
+  void gather_coordinates(std::vector<Real> (&coords)[LIBMESH_DIM]) const;
+
+  /**
+   * Copies the coordinates of the nodes in \p nodes into \p coords.
+   */
+  void gather_coordinates(std::vector<Real> (&coords)[LIBMESH_DIM],
+                          const std::vector<Node *> & nodes) const;
+
+  /**
+   * Copies the coordinates in \p coords back to the nodes with ids
+   * in \p node_ids.
+   */
+  void scatter_coordinates(const std::vector<Real> (&coords)[LIBMESH_DIM],
+                           const std::vector<dof_id_type> & node_ids);
 
   /**
    * True if the L-graph has been created, false otherwise.
@@ -99,9 +127,33 @@ private:
   bool _initialized;
 
   /**
-   * Data structure for holding the L-graph
+   * The mesh revision() the L-graph was built for.
+   */
+  unsigned int _graph_revision;
+
+  /**
+   * The L-graph in compressed row form: the nodes connected to node
+   * \p i are _graph_neighbors[_graph_offsets[i]] through
+   * _graph_neighbors[_graph_offsets[i+1]-1].
+   */
+  std::vector<dof_id_type> _graph_offsets;
+  std::vector<dof_id_type> _graph_neighbors;
+
+  /**
+   * Whether each node, indexed by id, lies on the mesh boundary.
+   */
+  std::vector<bool> _on_boundary;
+
+  /**
+   * The local nodes which are relocated by each sweep.
+   */
+  std::vector<dof_id_type> _movable_nodes;
+
+  /**
+   * The non-local nodes whose positions the sweeps read; only these
+   * need to be synchronized between iterations.
    */
-  std::vector<std::vector<dof_id_type> > _graph;
+  std::vector<Node *> _ghost_neighbors;
 };
 
 
@@ -436,6 +436,14 @@ private:
                     int msglev);
 
   void gener(char grid[], int n);
+
+  /**
+   * Functors which compute the local Hessians and gradients, or just
+   * the local functional values, of a range of cells for minJ(), so
+   * that those loops can be run with Threads::parallel_for().
+   */
+  class ComputeLocalMatrices;
+  class ComputeLocalFunctional;
 };
 
 } // namespace libMesh
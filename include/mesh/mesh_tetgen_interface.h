@@ -159,6 +159,14 @@ protected:
    */
   std::vector<unsigned> _sequential_to_libmesh_node_map;
 
+  /**
+   * The inverse of \p _sequential_to_libmesh_node_map: the TetGen
+   * index of each libMesh node id, or -1 for ids which are not in
+   * use.  This makes copying the facets in a direct lookup per
+   * vertex, without requiring the node ids to be sorted.
+   */
+  std::vector<int> _libmesh_to_sequential_node_map;
+
   /**
    * Tetgen only operates on serial meshes.
    */
@@ -357,6 +357,14 @@ void find_nodal_neighbors(const MeshBase & mesh,
                           const std::vector<std::vector<const Elem *> > & nodes_to_elem_map,
                           std::vector<const Node *> & neighbors);
 
+/**
+ * The same, but using the cached MeshBase::node_elem_adjacency()
+ * instead of a user-built node to element map.
+ */
+void find_nodal_neighbors(const MeshBase & mesh,
+                          const Node & n,
+                          std::vector<const Node *> & neighbors);
+
 /**
  * Given a mesh hanging_nodes will be filled with an associative array keyed off the
  * global id of all the hanging nodes in the mesh.  It will hold an array of the
@@ -378,6 +386,25 @@ void find_hanging_nodes_and_parents(const MeshBase & mesh,
  */
 void correct_node_proc_ids(MeshBase &);
 
+/**
+ * Limits each call of the \p libmesh_assert_valid_* consistency
+ * checks below which loop over all element or node ids to a window
+ * of at most \p n ids.  Successive calls check successive windows, so
+ * that a simulation which checks its mesh often still covers all of
+ * it, at a cost per check which does not grow with the mesh size.
+ *
+ * The default, 0, checks every id.  It can also be set with
+ * "--mesh-check-sample-size n" on the command line.  The value must
+ * be the same on all processors.
+ */
+void set_assert_valid_sample_size (dof_id_type n);
+
+/**
+ * \returns The number of ids which each consistency check looks at,
+ * or 0 if they look at all of them.
+ */
+dof_id_type assert_valid_sample_size ();
+
 
 #ifdef DEBUG
 /**
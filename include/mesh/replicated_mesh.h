@@ -456,6 +456,13 @@ protected:
 
 private:
 
+  /**
+   * Helper function for renumber_nodes_and_elements() that packs and
+   * sorts \p _elements by refinement level and then by the Morton
+   * index of each element centroid.  Element ids are not changed.
+   */
+  void sort_elements_spatially ();
+
   /**
    * Helper function for stitch_meshes and stitch_surfaces
    * that does the mesh stitching.
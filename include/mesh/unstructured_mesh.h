@@ -167,8 +167,27 @@ public:
    * elements in the mesh.
    */
   virtual bool contract () libmesh_override;
+
+  /**
+   * Updates neighbor links after the elements in \p refined_elems,
+   * and nothing else, have been refined: only the new children and
+   * the finer elements which were linked to a refined element are
+   * visited.  Falls back on \p find_neighbors() on a mesh which is
+   * not replicated.
+   */
+  virtual void find_neighbors_after_refinement (const std::vector<Elem *> & refined_elems) libmesh_override;
 #endif // #ifdef LIBMESH_ENABLE_AMR
 
+private:
+
+#ifdef LIBMESH_ENABLE_AMR
+  /**
+   * Fills in the missing neighbor links of the child element \p
+   * current_elem from those of its parent, and updates its
+   * interior_parent() link.
+   */
+  void find_neighbors_from_parent (Elem * current_elem);
+#endif // #ifdef LIBMESH_ENABLE_AMR
 };
 
 
@@ -36,6 +36,7 @@ namespace libMesh
 
 // Forward declarations
 class MeshBase;
+class TextScanner;
 
 /**
  * The \p UNVIO class implements the Ideas \p UNV universal
@@ -108,10 +109,10 @@ private:
 
   /**
    * The actual implementation of the read function.
-   * The public read interface simply decides which
-   * type of stream to pass the implementation.
+   * The public read interface simply decides whether
+   * to map the file or to decompress it for the implementation.
    */
-  void read_implementation (std::istream & in_stream);
+  void read_implementation (TextScanner & in_stream);
 
   /**
    * The actual implementation of the write function.
@@ -126,7 +127,7 @@ private:
   /**
    * Read nodes from file.
    */
-  void nodes_in (std::istream & in_file);
+  void nodes_in (TextScanner & in_file);
 
   /**
    * Method reads elements and stores them in
@@ -134,13 +135,13 @@ private:
    * come in. Within \p UNVIO, element labels are
    * ignored.
    */
-  void elements_in (std::istream & in_file);
+  void elements_in (TextScanner & in_file);
 
   /**
    * Reads the "groups" section of the file. The format of the groups section is described here:
    * http://www.sdrl.uc.edu/universal-file-formats-for-modal-analysis-testing-1/file-format-storehouse/unv_2467.htm
    */
-  void groups_in(std::istream & in_file);
+  void groups_in(TextScanner & in_file);
 
   //-------------------------------------------------------------
   // write support methods
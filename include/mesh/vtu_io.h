@@ -0,0 +1,118 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_VTU_IO_H
+#define LIBMESH_VTU_IO_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/mesh_output.h"
+#include "libmesh/parallel_object.h"
+
+// C++ includes
+#include <string>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward declarations
+class MeshBase;
+
+/**
+ * This class writes meshes and nodal data in the VTK XML
+ * UnstructuredGrid (.vtu) format without needing the VTK library.
+ *
+ * Every processor writes its active local elements, and the nodes
+ * they touch, as a piece of its own; processor 0 adds a .pvtu file
+ * which collects the pieces.  On one processor a name ending in .vtu
+ * gives just that file.  All arrays go into a raw binary appended
+ * section, optionally as zlib compressed blocks, and are streamed
+ * straight from the mesh and the solution vector.
+ */
+class VTUIO : public MeshOutput<MeshBase>,
+              public ParallelObject
+{
+public:
+
+  /**
+   * Constructor.  Takes a read-only reference to a mesh object,
+   * which may be distributed.
+   */
+  explicit
+  VTUIO (const MeshBase & mesh);
+
+  /**
+   * Writes the mesh without solutions.
+   */
+  virtual void write (const std::string & name) libmesh_override;
+
+  /**
+   * Writes the mesh with the nodal data \p soln, which holds the
+   * values of the variables \p names at every node.
+   */
+  virtual void write_nodal_data (const std::string & name,
+                                 const std::vector<Number> & soln,
+                                 const std::vector<std::string> & names) libmesh_override;
+
+  /**
+   * Writes the mesh with the nodal data \p parallel_soln, a
+   * type=PARALLEL vector in node-major order.  Each processor only
+   * fetches the entries of the nodes in its own piece.
+   */
+  virtual void write_nodal_data (const std::string & name,
+                                 const NumericVector<Number> & parallel_soln,
+                                 const std::vector<std::string> & names) libmesh_override;
+
+  /**
+   * Setter for compression flag.  Compression needs zlib, and is
+   * ignored without it.
+   */
+  void set_compression (bool b);
+
+private:
+
+  /**
+   * Writes this processor's piece, and the .pvtu file if one is
+   * needed.  The value of variable \p c at the i-th node of the
+   * piece is entry i*names.size()+c of \p values, or entry
+   * id*names.size()+c if \p by_node_id is true.
+   */
+  void write_pieces (const std::string & name,
+                     const std::vector<const Node *> & nodes,
+                     const std::vector<Number> & values,
+                     bool by_node_id,
+                     const std::vector<std::string> & names);
+
+  /**
+   * Fills \p nodes with the nodes of this processor's active local
+   * elements, in the order they are written.
+   */
+  void piece_nodes (std::vector<const Node *> & nodes) const;
+
+  /**
+   * Flag to indicate whether the output should be compressed
+   */
+  bool _compress;
+};
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_VTU_IO_H
@@ -109,6 +109,22 @@ public:
   virtual void operator() (const Point & p,
                            const Real time,
                            DenseVector<Output> & output) libmesh_override;
+
+  /**
+   * Calls the scalar function pointer directly for every point.
+   */
+  virtual void evaluate_batch (const std::vector<Point> & p,
+                               const Real time,
+                               std::vector<Output> & output) libmesh_override;
+
+  /**
+   * Calls the vector function pointer for every point, reusing one
+   * output buffer.
+   */
+  virtual void component_batch (unsigned int i,
+                                const std::vector<Point> & p,
+                                const Real time,
+                                std::vector<Output> & output) libmesh_override;
 };
 
 
@@ -139,6 +155,44 @@ void AnalyticFunction<Output>::operator() (const Point & p,
 
 
 
+template <typename Output>
+inline
+void AnalyticFunction<Output>::evaluate_batch (const std::vector<Point> & p,
+                                               const Real time,
+                                               std::vector<Output> & output)
+{
+  libmesh_assert (this->initialized());
+  libmesh_assert (this->_number_fptr);
+
+  output.resize(p.size());
+  for (std::size_t qp=0; qp != p.size(); ++qp)
+    output[qp] = this->_number_fptr(p[qp], time);
+}
+
+
+
+template <typename Output>
+inline
+void AnalyticFunction<Output>::component_batch (unsigned int i,
+                                                const std::vector<Point> & p,
+                                                const Real time,
+                                                std::vector<Output> & output)
+{
+  libmesh_assert (this->initialized());
+  libmesh_assert (this->_vector_fptr);
+
+  output.resize(p.size());
+
+  DenseVector<Output> outvec(i+1);
+  for (std::size_t qp=0; qp != p.size(); ++qp)
+    {
+      this->_vector_fptr(outvec, p[qp], time);
+      output[qp] = outvec(i);
+    }
+}
+
+
+
 template <typename Output>
 AnalyticFunction<Output>::AnalyticFunction (Output fptr(const Point & p,
                                                         const Real time)) :
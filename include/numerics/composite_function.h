@@ -145,6 +145,37 @@ public:
       component(reverse_index_map[i].second,p,time);
   }
 
+  virtual void evaluate_batch (const std::vector<Point> & p,
+                               const Real time,
+                               std::vector<Output> & output) libmesh_override
+  {
+    this->component_batch(0,p,time,output);
+  }
+
+  /**
+   * Evaluates component \p i at every point in \p p with a single
+   * batch call to the subfunction which provides it.
+   */
+  virtual void component_batch (unsigned int i,
+                                const std::vector<Point> & p,
+                                const Real time,
+                                std::vector<Output> & output) libmesh_override
+  {
+    if (i >= reverse_index_map.size() ||
+        reverse_index_map[i].first == libMesh::invalid_uint)
+      {
+        output.assign(p.size(), Output(0));
+        return;
+      }
+
+    libmesh_assert_less(reverse_index_map[i].first,
+                        subfunctions.size());
+    libmesh_assert_not_equal_to(reverse_index_map[i].second,
+                                libMesh::invalid_uint);
+    subfunctions[reverse_index_map[i].first]->
+      component_batch(reverse_index_map[i].second,p,time,output);
+  }
+
   virtual UniquePtr<FunctionBase<Output> > clone() const libmesh_override
   {
     CompositeFunction * returnval = new CompositeFunction();
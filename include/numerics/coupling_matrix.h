@@ -98,6 +98,22 @@ public:
 
   CouplingMatrix & operator&= (const CouplingMatrix & other);
 
+  /**
+   * A block of consecutive nonzero columns within one row, as the
+   * pair (first column, last column).
+   */
+  typedef std::pair<unsigned int, unsigned int> block_type;
+
+  /**
+   * Fills \p blocks with the maximal blocks of consecutive nonzero
+   * columns in row \p i, in increasing order.  This costs only a
+   * bisection plus the number of blocks found, so e.g. a
+   * block-diagonal coupling yields a single block per row regardless
+   * of the block size.
+   */
+  void row_blocks (const unsigned int i,
+                   std::vector<block_type> & blocks) const;
+
 private:
 
   friend class ConstCouplingAccessor;
@@ -619,6 +635,43 @@ bool CouplingMatrix::empty() const
 }
 
 
+
+inline
+void CouplingMatrix::row_blocks (const unsigned int i,
+                                 std::vector<block_type> & blocks) const
+{
+  libmesh_assert_less (i, _size);
+
+  blocks.clear();
+
+  const std::size_t row_begin = std::size_t(i)*_size;
+  const std::size_t row_end   = row_begin + _size;
+
+  // Find the first range which might reach into this row
+  rc_type::const_iterator it = std::upper_bound
+    (_ranges.begin(), _ranges.end(),
+     std::make_pair(row_begin, std::numeric_limits<std::size_t>::max()));
+  if (it != _ranges.begin())
+    {
+      --it;
+      if (it->second < row_begin)
+        ++it;
+    }
+
+  // Ranges are sorted and don't touch, so their pieces within this
+  // row are exactly its maximal blocks
+  for (; it != _ranges.end() && it->first < row_end; ++it)
+    {
+      const std::size_t first = std::max(it->first, row_begin);
+      const std::size_t last  = std::min(it->second, row_end-1);
+
+      blocks.push_back
+        (std::make_pair(cast_int<unsigned int>(first - row_begin),
+                        cast_int<unsigned int>(last - row_begin)));
+    }
+}
+
+
 } // namespace libMesh
 
 
@@ -368,6 +368,16 @@ public:
   void lu_solve (const DenseVector<T> & b,
                  DenseVector<T> & x);
 
+  /**
+   * Solves AX=B for the n x k matrix X, given the n x k matrix B
+   * whose columns are k right hand sides.  The LU factorization is
+   * computed (or reused) once, as in the single vector version, and
+   * each triangular sweep updates all the right hand sides together,
+   * so the factors are read once rather than k times.
+   */
+  void lu_solve (const DenseMatrix<T> & B,
+                 DenseMatrix<T> & X);
+
   /**
    * For symmetric positive definite (SPD) matrices. A Cholesky factorization
    * of A such that A = L L^T is about twice as fast as a standard LU
@@ -612,6 +622,12 @@ private:
    */
   void _lu_decompose_lapack();
 
+  /**
+   * Computes the LU factorization used by lu_solve(), with whichever
+   * backend \p use_blas_lapack selects, unless it is already present.
+   */
+  void _lu_factor ();
+
   /**
    * Computes an SVD of the matrix using the
    * Lapack routine "getsvd".
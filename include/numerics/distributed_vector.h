@@ -248,6 +248,16 @@ public:
    */
   virtual T operator() (const numeric_index_type i) const libmesh_override;
 
+  /**
+   * Access multiple components at once.  \p values will *not* be
+   * reallocated; it should already have enough space.  Reads straight
+   * from the local storage rather than through \p operator().
+   */
+  virtual void get(const std::vector<numeric_index_type> & index,
+                   T * values) const libmesh_override;
+
+  using NumericVector<T>::get;
+
   /**
    * Add \p v to *this. Equivalent to \p U.add(1, V).
    *
@@ -308,6 +318,12 @@ public:
    */
   virtual void add (const T a, const NumericVector<T> & v) libmesh_override;
 
+  virtual void waxpby (const T a, const NumericVector<T> & x,
+                       const T b, const NumericVector<T> & y) libmesh_override;
+
+  virtual void add_multiple (const std::vector<T> & a,
+                             const std::vector<const NumericVector<T> *> & v) libmesh_override;
+
   /**
    * We override one NumericVector<T>::add_vector() method but don't
    * want to hide the other defaults.
@@ -349,6 +365,9 @@ public:
    */
   virtual T dot(const NumericVector<T> & V) const libmesh_override;
 
+  virtual void dot_multiple (const std::vector<const NumericVector<T> *> & V,
+                             std::vector<T> & dots) const libmesh_override;
+
   /**
    * Creates a copy of the global vector in the local vector \p
    * v_local.
@@ -748,6 +767,28 @@ T DistributedVector<T>::operator() (const numeric_index_type i) const
 
 
 
+template <typename T>
+inline
+void DistributedVector<T>::get(const std::vector<numeric_index_type> & index,
+                               T * values) const
+{
+  libmesh_assert (this->initialized());
+  libmesh_assert_equal_to (_values.size(), _local_size);
+
+  const std::size_t num = index.size();
+  const numeric_index_type first = _first_local_index;
+  const T * local_values = _values.empty() ? libmesh_nullptr : &_values[0];
+
+  for (std::size_t i=0; i<num; i++)
+    {
+      libmesh_assert_greater_equal (index[i], first);
+      libmesh_assert_less (index[i] - first, _local_size);
+      values[i] = local_values[index[i] - first];
+    }
+}
+
+
+
 template <typename T>
 inline
 void DistributedVector<T>::set (const numeric_index_type i, const T value)
@@ -33,6 +33,7 @@
 // C++ includes
 #include <algorithm>
 #include <cstddef>
+#include <vector>
 
 namespace libMesh
 {
@@ -122,11 +123,12 @@ public:
   virtual void zero () libmesh_override;
 
   /**
-   * Close the matrix.  Dummy routine.  After calling
+   * Close the matrix.  Entries added before the matrix had a nonzero
+   * pattern are inserted all at once here.  After calling
    * this method \p closed() is true and the matrix can
    * be used in computations.
    */
-  virtual void close () const libmesh_override { const_cast<EigenSparseMatrix<T> *>(this)->_closed = true; }
+  virtual void close () const libmesh_override;
 
   /**
    * \returns \p m, the row-dimension of
@@ -270,6 +272,20 @@ private:
    */
   bool _closed;
 
+  /**
+   * Entries added while \p _mat has no nonzero pattern yet, i.e.
+   * during the first assembly.  Inserting those one by one into a
+   * row-major Eigen matrix shifts the following entries of the row
+   * each time, so we collect them and build \p _mat from them at
+   * once.  Later assemblies add to the existing pattern directly.
+   */
+  mutable std::vector<Eigen::Triplet<T, eigen_idx_type> > _triplets;
+
+  /**
+   * Builds \p _mat from, or adds to it, the entries in \p _triplets.
+   */
+  void flush_triplets () const;
+
   /**
    * Make other Eigen datatypes friends
    */
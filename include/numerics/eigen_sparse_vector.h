@@ -253,6 +253,16 @@ public:
    */
   virtual T operator() (const numeric_index_type i) const libmesh_override;
 
+  /**
+   * Access multiple components at once.  \p values will *not* be
+   * reallocated; it should already have enough space.  Reads straight
+   * from the local storage rather than through \p operator().
+   */
+  virtual void get(const std::vector<numeric_index_type> & index,
+                   T * values) const libmesh_override;
+
+  using NumericVector<T>::get;
+
   /**
    * Add \p v to *this. Equivalent to \p U.add(1, V).
    *
@@ -313,6 +323,12 @@ public:
    */
   virtual void add (const T a, const NumericVector<T> & v) libmesh_override;
 
+  virtual void waxpby (const T a, const NumericVector<T> & x,
+                       const T b, const NumericVector<T> & y) libmesh_override;
+
+  virtual void add_multiple (const std::vector<T> & a,
+                             const std::vector<const NumericVector<T> *> & v) libmesh_override;
+
   /**
    * We override one NumericVector<T>::add_vector() method but don't
    * want to hide the other defaults.
@@ -348,6 +364,9 @@ public:
    */
   virtual T dot(const NumericVector<T> & V) const libmesh_override;
 
+  virtual void dot_multiple (const std::vector<const NumericVector<T> *> & V,
+                             std::vector<T> & dots) const libmesh_override;
+
   /**
    * Creates a copy of the global vector in the local vector \p
    * v_local.
@@ -660,6 +679,25 @@ numeric_index_type EigenSparseVector<T>::last_local_index () const
 
 
 
+template <typename T>
+inline
+void EigenSparseVector<T>::get(const std::vector<numeric_index_type> & index,
+                               T * values) const
+{
+  libmesh_assert (this->initialized());
+
+  const std::size_t num = index.size();
+  const T * local_values = _vec.data();
+
+  for (std::size_t i=0; i<num; i++)
+    {
+      libmesh_assert_less (index[i], this->size());
+      values[i] = local_values[index[i]];
+    }
+}
+
+
+
 template <typename T>
 inline
 void EigenSparseVector<T>::set (const numeric_index_type i, const T value)
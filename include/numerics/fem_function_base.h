@@ -21,7 +21,7 @@
 #define LIBMESH_FEM_FUNCTION_BASE_H
 
 // C++ includes
-
+#include <vector>
 
 
 // Local Includes
@@ -124,6 +124,31 @@ public:
                            unsigned int i,
                            const Point & p,
                            Real time=0.);
+
+  /**
+   * Evaluates the scalar function at every point in \p p at time
+   * \p time, resizing \p output to hold one value per point.
+   *
+   * The default implementation calls \p operator() point by point;
+   * subclasses which can share work between points should override it.
+   */
+  virtual void evaluate_batch (const FEMContext &,
+                               const std::vector<Point> & p,
+                               const Real time,
+                               std::vector<Output> & output);
+
+  /**
+   * Evaluates vector component \p i at every point in \p p at time
+   * \p time, resizing \p output to hold one value per point.
+   *
+   * The default implementation calls \p component() point by point;
+   * subclasses which can share work between points should override it.
+   */
+  virtual void component_batch (const FEMContext &,
+                                unsigned int i,
+                                const std::vector<Point> & p,
+                                const Real time,
+                                std::vector<Output> & output);
 };
 
 template <typename Output>
@@ -138,6 +163,31 @@ Output FEMFunctionBase<Output>::component (const FEMContext & context,
   return outvec(i);
 }
 
+template <typename Output>
+inline
+void FEMFunctionBase<Output>::evaluate_batch (const FEMContext & context,
+                                              const std::vector<Point> & p,
+                                              const Real time,
+                                              std::vector<Output> & output)
+{
+  output.resize(p.size());
+  for (std::size_t qp=0; qp != p.size(); ++qp)
+    output[qp] = (*this)(context, p[qp], time);
+}
+
+template <typename Output>
+inline
+void FEMFunctionBase<Output>::component_batch (const FEMContext & context,
+                                               unsigned int i,
+                                               const std::vector<Point> & p,
+                                               const Real time,
+                                               std::vector<Output> & output)
+{
+  output.resize(p.size());
+  for (std::size_t qp=0; qp != p.size(); ++qp)
+    output[qp] = this->component(context, i, p[qp], time);
+}
+
 template <typename Output>
 inline
 void FEMFunctionBase<Output>::operator() (const FEMContext & context,
@@ -0,0 +1,521 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FIXED_DENSE_MATRIX_H
+#define LIBMESH_FIXED_DENSE_MATRIX_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/dense_matrix_base.h"
+#include "libmesh/dense_vector.h"
+#include "libmesh/libmesh.h"
+
+// C++ includes
+#include <algorithm>
+#include <cstdlib> // *must* precede <cmath> for proper std:abs() on PGI, Sun Studio CC
+#include <cmath>
+
+namespace libMesh
+{
+
+/**
+ * A dense matrix whose dimensions are fixed at compile time, stored
+ * in place rather than in a heap-allocated std::vector.  It is meant
+ * for the small element matrices of common element types (8x8 for
+ * HEX8, 27x27 for HEX27, ...) where the loop bounds being known to
+ * the compiler lets every kernel below be fully unrolled.
+ *
+ * The interface follows \p DenseMatrix for \p vector_mult(),
+ * \p right_multiply(), \p lu_solve() and \p cholesky_solve(), with
+ * the same decomposition semantics: after a solve the matrix holds
+ * its factors and may be reused for further solves with other
+ * right hand sides.  \p add_to() and \p assign_from() move data to
+ * and from a \p DenseMatrix or a \p DenseSubMatrix block of one
+ * through their inline accessors.
+ */
+template <unsigned int M, unsigned int N, typename T>
+class FixedDenseMatrix : public DenseMatrixBase<T>
+{
+public:
+
+  /**
+   * Constructor.  The matrix is zeroed.
+   */
+  FixedDenseMatrix ();
+
+  virtual ~FixedDenseMatrix() {}
+
+  virtual void zero () libmesh_override;
+
+  /**
+   * \returns The \p (i,j) element of the matrix.
+   */
+  T operator() (const unsigned int i,
+                const unsigned int j) const;
+
+  /**
+   * \returns The \p (i,j) element of the matrix as a writable reference.
+   */
+  T & operator() (const unsigned int i,
+                  const unsigned int j);
+
+  virtual T el (const unsigned int i,
+                const unsigned int j) const libmesh_override
+  { return (*this)(i,j); }
+
+  virtual T & el (const unsigned int i,
+                  const unsigned int j) libmesh_override
+  { return (*this)(i,j); }
+
+  /**
+   * Left multiplies by the matrix \p M2, which must be M x M.
+   */
+  virtual void left_multiply (const DenseMatrixBase<T> & M2) libmesh_override;
+
+  /**
+   * Right multiplies by the matrix \p M3, which must be N x N.
+   */
+  virtual void right_multiply (const DenseMatrixBase<T> & M3) libmesh_override;
+
+  /**
+   * Right multiplies by the fixed size matrix \p M3.
+   */
+  void right_multiply (const FixedDenseMatrix<N, N, T> & M3);
+
+  /**
+   * Performs the matrix-vector multiplication,
+   * \p dest := (*this) * \p arg.
+   */
+  void vector_mult (DenseVector<T> & dest,
+                    const DenseVector<T> & arg) const;
+
+  /**
+   * Performs the matrix-vector multiplication,
+   * \p dest += \p factor * (*this) * \p arg.
+   */
+  void vector_mult_add (DenseVector<T> & dest,
+                        const T factor,
+                        const DenseVector<T> & arg) const;
+
+  /**
+   * Solve the system Ax=b given the input vector b.  Partial pivoting
+   * is performed by default in order to keep the algorithm stable to
+   * the effects of round-off error.
+   */
+  void lu_solve (const DenseVector<T> & b,
+                 DenseVector<T> & x);
+
+  /**
+   * For symmetric positive definite (SPD) matrices. A Cholesky factorization
+   * of A such that A = L L^T is about twice as fast as a standard LU
+   * factorization.  Therefore you can use this method if you know a-priori
+   * that the matrix is SPD.  If the matrix is not SPD, an error is generated.
+   */
+  void cholesky_solve (const DenseVector<T> & b,
+                       DenseVector<T> & x);
+
+  /**
+   * Adds \p factor times this matrix to \p dest, which may be any
+   * matrix type with an inline \p operator() (notably \p DenseMatrix
+   * and \p DenseSubMatrix) of the same dimensions.
+   */
+  template <typename MatrixType>
+  void add_to (MatrixType & dest, const T factor = 1.) const;
+
+  /**
+   * Copies the entries of \p src, which must have the same dimensions.
+   */
+  template <typename MatrixType>
+  void assign_from (const MatrixType & src);
+
+  /**
+   * \returns A pointer to the row-major entries.
+   */
+  const T * get_values () const { return _val; }
+  T * get_values () { return _val; }
+
+private:
+
+  /**
+   * The row-major entries.
+   */
+  T _val[M*N];
+
+  /**
+   * The row pivots of an LU decomposition.
+   */
+  unsigned int _pivots[M];
+
+  /**
+   * The decomposition currently stored in \p _val, if any.
+   */
+  enum DecompositionType {LU=0, CHOLESKY=1, NONE};
+  DecompositionType _decomposition_type;
+
+  void _lu_decompose ();
+  void _cholesky_decompose ();
+};
+
+
+
+// ------------------------------------------------------------
+// FixedDenseMatrix member functions
+template <unsigned int M, unsigned int N, typename T>
+inline
+FixedDenseMatrix<M,N,T>::FixedDenseMatrix () :
+  DenseMatrixBase<T>(M, N),
+  _decomposition_type(NONE)
+{
+  this->zero();
+}
+
+
+
+template <unsigned int M, unsigned int N, typename T>
+inline
+void FixedDenseMatrix<M,N,T>::zero ()
+{
+  _decomposition_type = NONE;
+  std::fill (_val, _val + M*N, T(0));
+}
+
+
+
+template <unsigned int M, unsigned int N, typename T>
+inline
+T FixedDenseMatrix<M,N,T>::operator () (const unsigned int i,
+                                        const unsigned int j) const
+{
+  libmesh_assert_less (i, M);
+  libmesh_assert_less (j, N);
+
+  return _val[i*N + j];
+}
+
+
+
+template <unsigned int M, unsigned int N, typename T>
+inline
+T & FixedDenseMatrix<M,N,T>::operator () (const unsigned int i,
+                                          const unsigned int j)
+{
+  libmesh_assert_less (i, M);
+  libmesh_assert_less (j, N);
+
+  return _val[i*N + j];
+}
+
+
+
+template <unsigned int M, unsigned int N, typename T>
+inline
+void FixedDenseMatrix<M,N,T>::left_multiply (const DenseMatrixBase<T> & M2)
+{
+  libmesh_assert_equal_to (M2.m(), M);
+  libmesh_assert_equal_to (M2.n(), M);
+
+  const FixedDenseMatrix<M,N,T> orig(*this);
+
+  for (unsigned int i=0; i != M; ++i)
+    for (unsigned int j=0; j != N; ++j)
+      {
+        T sum = 0;
+        for (unsigned int k=0; k != M; ++k)
+          sum += M2.el(i,k) * orig._val[k*N + j];
+        _val[i*N + j] = sum;
+      }
+}
+
+
+
+template <unsigned int M, unsigned int N, typename T>
+inline
+void FixedDenseMatrix<M,N,T>::right_multiply (const DenseMatrixBase<T> & M3)
+{
+  libmesh_assert_equal_to (M3.m(), N);
+  libmesh_assert_equal_to (M3.n(), N);
+
+  FixedDenseMatrix<N,N,T> fixed_M3;
+  for (unsigned int i=0; i != N; ++i)
+    for (unsigned int j=0; j != N; ++j)
+      fixed_M3(i,j) = M3.el(i,j);
+
+  this->right_multiply(fixed_M3);
+}
+
+
+
+template <unsigned int M, unsigned int N, typename T>
+inline
+void FixedDenseMatrix<M,N,T>::right_multiply (const FixedDenseMatrix<N,N,T> & M3)
+{
+  const T * b = M3.get_values();
+
+  for (unsigned int i=0; i != M; ++i)
+    {
+      T row[N];
+      for (unsigned int j=0; j != N; ++j)
+        row[j] = _val[i*N + j];
+
+      for (unsigned int j=0; j != N; ++j)
+        {
+          T sum = 0;
+          for (unsigned int k=0; k != N; ++k)
+            sum += row[k] * b[k*N + j];
+          _val[i*N + j] = sum;
+        }
+    }
+}
+
+
+
+template <unsigned int M, unsigned int N, typename T>
+inline
+void FixedDenseMatrix<M,N,T>::vector_mult (DenseVector<T> & dest,
+                                           const DenseVector<T> & arg) const
+{
+  libmesh_assert_equal_to (arg.size(), N);
+
+  dest.resize(M);
+  this->vector_mult_add(dest, 1., arg);
+}
+
+
+
+template <unsigned int M, unsigned int N, typename T>
+inline
+void FixedDenseMatrix<M,N,T>::vector_mult_add (DenseVector<T> & dest,
+                                               const T factor,
+                                               const DenseVector<T> & arg) const
+{
+  libmesh_assert_equal_to (arg.size(), N);
+  libmesh_assert_equal_to (dest.size(), M);
+
+  const T * x = &arg.get_values()[0];
+  T * y = &dest.get_values()[0];
+
+  for (unsigned int i=0; i != M; ++i)
+    {
+      T sum = 0;
+      for (unsigned int j=0; j != N; ++j)
+        sum += _val[i*N + j] * x[j];
+      y[i] += factor * sum;
+    }
+}
+
+
+
+template <unsigned int M, unsigned int N, typename T>
+inline
+void FixedDenseMatrix<M,N,T>::lu_solve (const DenseVector<T> & b,
+                                        DenseVector<T> & x)
+{
+  libmesh_assert_equal_to (M, N);
+  libmesh_assert_equal_to (b.size(), M);
+
+  if (_decomposition_type == NONE)
+    this->_lu_decompose();
+  else if (_decomposition_type != LU)
+    libmesh_error_msg("Error! This matrix already has a different decomposition...");
+
+  T z[M];
+  for (unsigned int i=0; i != M; ++i)
+    z[i] = b(i);
+
+  x.resize(M);
+  T * xv = &x.get_values()[0];
+
+  // Lower-triangular "top to bottom" solve step, taking into account pivots
+  for (unsigned int i=0; i != M; ++i)
+    {
+      if (_pivots[i] != i)
+        std::swap (z[i], z[_pivots[i]]);
+
+      T xi = z[i];
+      for (unsigned int j=0; j != i; ++j)
+        xi -= _val[i*N + j] * xv[j];
+      xv[i] = xi / _val[i*N + i];
+    }
+
+  // Upper-triangular "bottom to top" solve step
+  for (unsigned int ib=M; ib != 0; --ib)
+    {
+      const unsigned int i = ib-1;
+      for (unsigned int j=i+1; j != M; ++j)
+        xv[i] -= _val[i*N + j] * xv[j];
+    }
+}
+
+
+
+template <unsigned int M, unsigned int N, typename T>
+inline
+void FixedDenseMatrix<M,N,T>::cholesky_solve (const DenseVector<T> & b,
+                                              DenseVector<T> & x)
+{
+  libmesh_assert_equal_to (M, N);
+  libmesh_assert_equal_to (b.size(), M);
+
+  if (_decomposition_type == NONE)
+    this->_cholesky_decompose();
+  else if (_decomposition_type != CHOLESKY)
+    libmesh_error_msg("Error! This matrix already has a different decomposition...");
+
+  x.resize(M);
+  T * xv = &x.get_values()[0];
+
+  // Solve for Ly=b
+  for (unsigned int i=0; i != M; ++i)
+    {
+      T temp = b(i);
+      for (unsigned int k=0; k != i; ++k)
+        temp -= _val[i*N + k] * xv[k];
+      xv[i] = temp / _val[i*N + i];
+    }
+
+  // Solve for L^T x = y
+  for (unsigned int ib=M; ib != 0; --ib)
+    {
+      const unsigned int i = ib-1;
+      for (unsigned int k=i+1; k != M; ++k)
+        xv[i] -= _val[k*N + i] * xv[k];
+      xv[i] /= _val[i*N + i];
+    }
+}
+
+
+
+template <unsigned int M, unsigned int N, typename T>
+template <typename MatrixType>
+inline
+void FixedDenseMatrix<M,N,T>::add_to (MatrixType & dest,
+                                      const T factor) const
+{
+  libmesh_assert_equal_to (dest.m(), M);
+  libmesh_assert_equal_to (dest.n(), N);
+
+  for (unsigned int i=0; i != M; ++i)
+    for (unsigned int j=0; j != N; ++j)
+      dest(i,j) += factor * _val[i*N + j];
+}
+
+
+
+template <unsigned int M, unsigned int N, typename T>
+template <typename MatrixType>
+inline
+void FixedDenseMatrix<M,N,T>::assign_from (const MatrixType & src)
+{
+  libmesh_assert_equal_to (src.m(), M);
+  libmesh_assert_equal_to (src.n(), N);
+
+  _decomposition_type = NONE;
+
+  for (unsigned int i=0; i != M; ++i)
+    for (unsigned int j=0; j != N; ++j)
+      _val[i*N + j] = src(i,j);
+}
+
+
+
+template <unsigned int M, unsigned int N, typename T>
+inline
+void FixedDenseMatrix<M,N,T>::_lu_decompose ()
+{
+  libmesh_assert_equal_to (_decomposition_type, NONE);
+
+  for (unsigned int i=0; i != M; ++i)
+    {
+      // Find the pivot row by searching down the i'th column
+      _pivots[i] = i;
+
+      // std::abs(complex) must return a Real!
+      Real the_max = std::abs( _val[i*N + i] );
+      for (unsigned int j=i+1; j != M; ++j)
+        {
+          const Real candidate_max = std::abs( _val[j*N + i] );
+          if (the_max < candidate_max)
+            {
+              the_max = candidate_max;
+              _pivots[i] = j;
+            }
+        }
+
+      // Interchange the entire rows, as in DenseMatrix::_lu_decompose()
+      if (_pivots[i] != i)
+        for (unsigned int j=0; j != N; ++j)
+          std::swap (_val[i*N + j], _val[_pivots[i]*N + j]);
+
+      if (_val[i*N + i] == libMesh::zero)
+        libmesh_error_msg("Matrix A is singular!");
+
+      // Scale upper triangle entries of row i by the diagonal entry
+      const T diag_inv = 1. / _val[i*N + i];
+      for (unsigned int j=i+1; j != N; ++j)
+        _val[i*N + j] *= diag_inv;
+
+      // Update the remaining sub-matrix
+      for (unsigned int row=i+1; row != M; ++row)
+        {
+          const T a_ri = _val[row*N + i];
+          for (unsigned int col=i+1; col != N; ++col)
+            _val[row*N + col] -= a_ri * _val[i*N + col];
+        }
+    }
+
+  _decomposition_type = LU;
+}
+
+
+
+template <unsigned int M, unsigned int N, typename T>
+inline
+void FixedDenseMatrix<M,N,T>::_cholesky_decompose ()
+{
+  libmesh_assert_equal_to (_decomposition_type, NONE);
+
+  for (unsigned int i=0; i != M; ++i)
+    for (unsigned int j=i; j != N; ++j)
+      {
+        T a_ij = _val[i*N + j];
+        for (unsigned int k=0; k != i; ++k)
+          a_ij -= _val[i*N + k] * _val[j*N + k];
+
+        if (i == j)
+          {
+#ifndef LIBMESH_USE_COMPLEX_NUMBERS
+            if (a_ij <= 0.0)
+              libmesh_error_msg("Error! Can only use Cholesky decomposition with symmetric positive definite matrices.");
+#endif
+
+            _val[i*N + i] = std::sqrt(a_ij);
+          }
+        else
+          {
+            _val[i*N + j] = a_ij;
+            _val[j*N + i] = a_ij / _val[i*N + i];
+          }
+      }
+
+  _decomposition_type = CHOLESKY;
+}
+
+} // namespace libMesh
+
+#endif // LIBMESH_FIXED_DENSE_MATRIX_H
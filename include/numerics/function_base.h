@@ -27,6 +27,7 @@
 
 // C++ includes
 #include <cstddef>
+#include <vector>
 
 namespace libMesh
 {
@@ -135,6 +136,29 @@ public:
                            const Point & p,
                            Real time=0.);
 
+  /**
+   * Evaluates the scalar function at every point in \p p at time
+   * \p time, resizing \p output to hold one value per point.
+   *
+   * The default implementation calls \p operator() point by point;
+   * subclasses which can share work between points should override it.
+   */
+  virtual void evaluate_batch (const std::vector<Point> & p,
+                               const Real time,
+                               std::vector<Output> & output);
+
+  /**
+   * Evaluates vector component \p i at every point in \p p at time
+   * \p time, resizing \p output to hold one value per point.
+   *
+   * The default implementation calls \p component() point by point;
+   * subclasses which can share work between points should override it.
+   */
+  virtual void component_batch (unsigned int i,
+                                const std::vector<Point> & p,
+                                const Real time,
+                                std::vector<Output> & output);
+
 
   /**
    * \returns \p true when this object is properly initialized
@@ -237,6 +261,33 @@ Output FunctionBase<Output>::component (unsigned int i,
 
 
 
+template <typename Output>
+inline
+void FunctionBase<Output>::evaluate_batch (const std::vector<Point> & p,
+                                           const Real time,
+                                           std::vector<Output> & output)
+{
+  output.resize(p.size());
+  for (std::size_t qp=0; qp != p.size(); ++qp)
+    output[qp] = (*this)(p[qp], time);
+}
+
+
+
+template <typename Output>
+inline
+void FunctionBase<Output>::component_batch (unsigned int i,
+                                            const std::vector<Point> & p,
+                                            const Real time,
+                                            std::vector<Output> & output)
+{
+  output.resize(p.size());
+  for (std::size_t qp=0; qp != p.size(); ++qp)
+    output[qp] = this->component(i, p[qp], time);
+}
+
+
+
 template <typename Output>
 inline
 void FunctionBase<Output>::operator() (const Point & p,
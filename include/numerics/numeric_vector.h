@@ -430,6 +430,25 @@ public:
    */
   virtual void add (const T a, const NumericVector<T> & v) = 0;
 
+  /**
+   * Sets u(i) <- a * x(i) + b * y(i) for each entry in the vector,
+   * overwriting the previous contents.  \p x and \p y must not be
+   * \p this vector.
+   *
+   * The default implementation is a copy followed by \p scale() and
+   * \p add(); subclasses should override it with a single pass.
+   */
+  virtual void waxpby (const T a, const NumericVector<T> & x,
+                       const T b, const NumericVector<T> & y);
+
+  /**
+   * Sets u(i) <- u(i) + sum_k a[k] * v[k](i) for each entry in the
+   * vector.  Time integrators use this to combine several old
+   * solution vectors without a pass over \p this for each one.
+   */
+  virtual void add_multiple (const std::vector<T> & a,
+                             const std::vector<const NumericVector<T> *> & v);
+
   /**
    * \f$ U+=v \f$ where v is a pointer and each \p dof_indices[i]
    * specifies where to add value \p v[i]
@@ -534,6 +553,14 @@ public:
    */
   virtual T dot(const NumericVector<T> & V) const = 0;
 
+  /**
+   * Sets \p dots[k] to the dot product of (*this) with \p V[k], as
+   * \p dot() would.  Subclasses may override this to compute every
+   * product in one pass with a single global reduction.
+   */
+  virtual void dot_multiple (const std::vector<const NumericVector<T> *> & V,
+                             std::vector<T> & dots) const;
+
   /**
    * Creates a copy of the global vector in the local vector \p
    * v_local.
@@ -553,6 +580,23 @@ public:
   virtual void localize (NumericVector<T> & v_local,
                          const std::vector<numeric_index_type> & send_list) const = 0;
 
+  /**
+   * Starts the same operation as \p localize(v_local, send_list), but
+   * may return before the values owned by other processors have
+   * arrived.  Entries of \p v_local owned by this processor are
+   * valid on return; the others only after the matching call to
+   * \p end_localize().  The default implementation does the whole
+   * localization here.
+   */
+  virtual void begin_localize (NumericVector<T> & v_local,
+                               const std::vector<numeric_index_type> & send_list) const
+  { this->localize(v_local, send_list); }
+
+  /**
+   * Completes a localization started by \p begin_localize().
+   */
+  virtual void end_localize (NumericVector<T> & /*v_local*/) const {}
+
   /**
    * Fill in the local std::vector "v_local" with the global indices
    * given in "indices".  Note that indices can be different on every
@@ -29,7 +29,7 @@
 
 #ifdef LIBMESH_HAVE_FPARSER
 // FParser includes
-#include "libmesh/fparser.hh"
+#include "libmesh/fparser_ad.hh"
 #endif
 
 // C++ includes
@@ -137,6 +137,21 @@ public:
   void set_inline_value(const std::string & inline_var_name,
                         Output newval);
 
+  /**
+   * Evaluate the subexpressions with machine code generated by the
+   * fparser JIT backend instead of the bytecode interpreter, now and
+   * after any later reparse.  Compiled objects are cached on disk
+   * under a hash of the bytecode and reused by later runs.  Without
+   * JIT support in fparser, or for subexpressions it can't compile,
+   * evaluation stays in the interpreter.
+   */
+  void enable_jit ();
+
+  /**
+   * \returns \p true if \p enable_jit() has been called.
+   */
+  bool jit_enabled () const { return _jit; }
+
 protected:
   // Helper function for reparsing minor changes to expression
   void partial_reparse (const std::string & expression);
@@ -152,7 +167,7 @@ protected:
 
   // Evaluate the ith FunctionParser and check the result
 #ifdef LIBMESH_HAVE_FPARSER
-  inline Output eval(FunctionParserBase<Output> & parser,
+  inline Output eval(FunctionParserADBase<Output> & parser,
                      const std::string & libmesh_dbg_var(function_name),
                      unsigned int libmesh_dbg_var(component_idx)) const;
 #else // LIBMESH_HAVE_FPARSER
@@ -171,7 +186,7 @@ private:
     _n_requested_hess_components;
   bool _requested_normals;
 #ifdef LIBMESH_HAVE_FPARSER
-  std::vector<FunctionParserBase<Output> > parsers;
+  std::vector<FunctionParserADBase<Output> > parsers;
 #else
   std::vector<char> parsers;
 #endif
@@ -195,6 +210,9 @@ private:
   std::string variables;
   std::vector<std::string> _additional_vars;
   std::vector<Output> _initial_vals;
+
+  // Should parsers be JIT compiled?
+  bool _jit;
 };
 
 
@@ -219,7 +237,8 @@ ParsedFEMFunction<Output>::ParsedFEMFunction (const System & sys,
   _need_var_hess(_n_vars*LIBMESH_DIM*LIBMESH_DIM, false),
 #endif // LIBMESH_ENABLE_SECOND_DERIVATIVES
   _additional_vars (additional_vars ? *additional_vars : std::vector<std::string>()),
-  _initial_vals (initial_vals ? *initial_vals : std::vector<Output>())
+  _initial_vals (initial_vals ? *initial_vals : std::vector<Output>()),
+  _jit (false)
 {
   this->reparse(expression);
 }
@@ -391,8 +410,14 @@ inline
 UniquePtr<FEMFunctionBase<Output> >
 ParsedFEMFunction<Output>::clone () const
 {
-  return UniquePtr<FEMFunctionBase<Output> >
-    (new ParsedFEMFunction(_sys, _expression, &_additional_vars, &_initial_vals));
+  ParsedFEMFunction * new_func =
+    new ParsedFEMFunction(_sys, _expression, &_additional_vars, &_initial_vals);
+
+  // Compiled objects are shared through the cache, so this is cheap
+  if (_jit)
+    new_func->enable_jit();
+
+  return UniquePtr<FEMFunctionBase<Output> >(new_func);
 }
 
 template <typename Output>
@@ -625,7 +650,7 @@ ParsedFEMFunction<Output>::partial_reparse (const std::string & expression)
 #ifdef LIBMESH_HAVE_FPARSER
       // Parse (and optimize if possible) the subexpression.
       // Add some basic constants, to Real precision.
-      FunctionParserBase<Output> fp;
+      FunctionParserADBase<Output> fp;
       fp.AddConstant("NaN", std::numeric_limits<Real>::quiet_NaN());
       fp.AddConstant("pi", std::acos(Real(-1)));
       fp.AddConstant("e", std::exp(Real(1)));
@@ -644,6 +669,30 @@ ParsedFEMFunction<Output>::partial_reparse (const std::string & expression)
       nextstart = (end == std::string::npos) ?
         std::string::npos : end + 1;
     }
+
+#ifdef LIBMESH_HAVE_FPARSER
+  // A failed compile leaves that parser in the interpreter, which is
+  // still correct, so the results are deliberately ignored.
+  if (_jit)
+    for (std::size_t i=0; i != parsers.size(); ++i)
+      parsers[i].JITCompile();
+#endif
+}
+
+template <typename Output>
+inline
+void
+ParsedFEMFunction<Output>::enable_jit ()
+{
+  if (_jit)
+    return;
+
+  _jit = true;
+
+#ifdef LIBMESH_HAVE_FPARSER
+  for (std::size_t i=0; i != parsers.size(); ++i)
+    parsers[i].JITCompile();
+#endif
 }
 
 template <typename Output>
@@ -804,7 +853,7 @@ ParsedFEMFunction<Output>::eval_args (const FEMContext & c,
 template <typename Output>
 inline
 Output
-ParsedFEMFunction<Output>::eval (FunctionParserBase<Output> & parser,
+ParsedFEMFunction<Output>::eval (FunctionParserADBase<Output> & parser,
                                  const std::string & libmesh_dbg_var(function_name),
                                  unsigned int libmesh_dbg_var(component_idx)) const
 {
@@ -92,6 +92,23 @@ public:
                             const Point & p,
                             Real time);
 
+  /**
+   * Evaluates the first subexpression at every point in \p p, without
+   * a virtual call per point.
+   */
+  virtual void evaluate_batch (const std::vector<Point> & p,
+                               const Real time,
+                               std::vector<Output> & output);
+
+  /**
+   * Evaluates subexpression \p i at every point in \p p, without a
+   * virtual call per point.
+   */
+  virtual void component_batch (unsigned int i,
+                                const std::vector<Point> & p,
+                                const Real time,
+                                std::vector<Output> & output);
+
   const std::string & expression() { return _expression; }
 
   /**
@@ -124,6 +141,22 @@ public:
   void set_inline_value(const std::string & inline_var_name,
                         Output newval);
 
+  /**
+   * Evaluate the expression and its derivatives with machine code
+   * generated by the fparser JIT backend instead of the bytecode
+   * interpreter, now and after any later reparse.  Compiled objects
+   * are cached in a \p .jitcache directory under a hash of the
+   * bytecode, so later runs with the same expressions skip the
+   * compiler.  Without JIT support in fparser, or for expressions it
+   * can't compile, evaluation stays in the interpreter.
+   */
+  void enable_jit ();
+
+  /**
+   * \returns \p true if \p enable_jit() has been called.
+   */
+  bool jit_enabled () const { return _jit; }
+
 protected:
   /**
    * Re-parse with minor changes to expression.
@@ -142,6 +175,11 @@ protected:
   bool expression_is_time_dependent( const std::string & expression ) const;
 
 private:
+  /**
+   * JIT compile every parser, where possible.
+   */
+  void jit_compile ();
+
   /**
    * Set the _spacetime argument vector.
    */
@@ -175,6 +213,9 @@ private:
   std::string variables;
   std::vector<std::string> _additional_vars;
   std::vector<Output> _initial_vals;
+
+  // Should parsers be JIT compiled?
+  bool _jit;
 };
 
 
@@ -191,7 +232,8 @@ ParsedFunction<Output,OutputGradient>::ParsedFunction (const std::string & expre
   _spacetime (LIBMESH_DIM+1 + (additional_vars ? additional_vars->size() : 0)),
   _valid_derivatives (true),
   _additional_vars (additional_vars ? *additional_vars : std::vector<std::string>()),
-  _initial_vals (initial_vals ? *initial_vals : std::vector<Output>())
+  _initial_vals (initial_vals ? *initial_vals : std::vector<Output>()),
+  _jit (false)
 {
   // time-dependence established in reparse function
   this->reparse(expression);
@@ -307,6 +349,34 @@ ParsedFunction<Output,OutputGradient>::component (unsigned int i,
   return eval(parsers[i], "f", i);
 }
 
+template <typename Output, typename OutputGradient>
+inline
+void
+ParsedFunction<Output,OutputGradient>::evaluate_batch (const std::vector<Point> & p,
+                                                       const Real time,
+                                                       std::vector<Output> & output)
+{
+  this->component_batch(0, p, time, output);
+}
+
+template <typename Output, typename OutputGradient>
+inline
+void
+ParsedFunction<Output,OutputGradient>::component_batch (unsigned int i,
+                                                        const std::vector<Point> & p,
+                                                        const Real time,
+                                                        std::vector<Output> & output)
+{
+  libmesh_assert_less (i, parsers.size());
+
+  output.resize(p.size());
+  for (std::size_t qp=0; qp != p.size(); ++qp)
+    {
+      set_spacetime(p[qp], time);
+      output[qp] = eval(parsers[i], "f", i);
+    }
+}
+
 /**
  * \returns The address of a parsed variable so you can supply a parameterized value
  */
@@ -331,8 +401,14 @@ inline
 UniquePtr<FunctionBase<Output> >
 ParsedFunction<Output,OutputGradient>::clone() const
 {
-  return UniquePtr<FunctionBase<Output> >
-    (new ParsedFunction(_expression, &_additional_vars, &_initial_vals));
+  ParsedFunction * new_func =
+    new ParsedFunction(_expression, &_additional_vars, &_initial_vals);
+
+  // Compiled objects are shared through the cache, so this is cheap
+  if (_jit)
+    new_func->enable_jit();
+
+  return UniquePtr<FunctionBase<Output> >(new_func);
 }
 
 template <typename Output, typename OutputGradient>
@@ -562,6 +638,46 @@ ParsedFunction<Output,OutputGradient>::partial_reparse (const std::string & expr
       nextstart = (end == std::string::npos) ?
         std::string::npos : end + 1;
     }
+
+  if (_jit)
+    this->jit_compile();
+}
+
+
+template <typename Output, typename OutputGradient>
+inline
+void
+ParsedFunction<Output,OutputGradient>::enable_jit ()
+{
+  if (_jit)
+    return;
+
+  _jit = true;
+  this->jit_compile();
+}
+
+
+template <typename Output, typename OutputGradient>
+inline
+void
+ParsedFunction<Output,OutputGradient>::jit_compile ()
+{
+  // A failed compile leaves that parser in the interpreter, which is
+  // still correct, so the results are deliberately ignored.
+  for (std::size_t i=0; i != parsers.size(); ++i)
+    parsers[i].JITCompile();
+  for (std::size_t i=0; i != dx_parsers.size(); ++i)
+    dx_parsers[i].JITCompile();
+#if LIBMESH_DIM > 1
+  for (std::size_t i=0; i != dy_parsers.size(); ++i)
+    dy_parsers[i].JITCompile();
+#endif
+#if LIBMESH_DIM > 2
+  for (std::size_t i=0; i != dz_parsers.size(); ++i)
+    dz_parsers[i].JITCompile();
+#endif
+  for (std::size_t i=0; i != dt_parsers.size(); ++i)
+    dt_parsers[i].JITCompile();
 }
 
 
@@ -707,6 +823,8 @@ public:
 
   virtual void init() {}
   virtual void clear() {}
+  void enable_jit() {}
+  bool jit_enabled() const { return false; }
   virtual Output & getVarAddress(const std::string & /*variable_name*/) { return _dummy; }
   virtual UniquePtr<FunctionBase<Output> > clone() const
   {
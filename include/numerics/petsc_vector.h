@@ -368,6 +368,12 @@ public:
    */
   virtual void add (const T a, const NumericVector<T> & v) libmesh_override;
 
+  virtual void waxpby (const T a, const NumericVector<T> & x,
+                       const T b, const NumericVector<T> & y) libmesh_override;
+
+  virtual void add_multiple (const std::vector<T> & a,
+                             const std::vector<const NumericVector<T> *> & v) libmesh_override;
+
   /**
    * We override two NumericVector<T>::add_vector() methods but don't
    * want to hide the other defaults.
@@ -443,6 +449,9 @@ public:
    */
   virtual T dot(const NumericVector<T> & v) const libmesh_override;
 
+  virtual void dot_multiple (const std::vector<const NumericVector<T> *> & V,
+                             std::vector<T> & dots) const libmesh_override;
+
   /**
    * \returns The dot product of (*this) with the vector \p v.
    *
@@ -469,6 +478,16 @@ public:
   virtual void localize (NumericVector<T> & v_local,
                          const std::vector<numeric_index_type> & send_list) const libmesh_override;
 
+  /**
+   * When localizing a parallel vector into a ghosted one, copies the
+   * local entries and only starts the ghost update, so that work
+   * which needs local values alone can overlap the communication.
+   */
+  virtual void begin_localize (NumericVector<T> & v_local,
+                               const std::vector<numeric_index_type> & send_list) const libmesh_override;
+
+  virtual void end_localize (NumericVector<T> & v_local) const libmesh_override;
+
   /**
    * Fill in the local std::vector "v_local" with the global indices
    * given in "indices".  See numeric_vector.h for more details.
@@ -1294,8 +1313,20 @@ void PetscVector<T>::get(const std::vector<numeric_index_type> & index,
 
   const std::size_t num = index.size();
 
+  // The array stays present until the vector is next modified, so
+  // the ownership range can be read once; only ghost entries need
+  // the map lookup.
+  const numeric_index_type first = _first;
+  const numeric_index_type last = _last;
+
   for (std::size_t i=0; i<num; i++)
     {
+      if (index[i] >= first && index[i] < last)
+        {
+          values[i] = static_cast<T>(_read_only_values[index[i] - first]);
+          continue;
+        }
+
       const numeric_index_type local_index = this->map_global_to_local_index(index[i]);
 #ifndef NDEBUG
       if (this->type() == GHOSTED)
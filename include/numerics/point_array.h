@@ -0,0 +1,264 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_POINT_ARRAY_H
+#define LIBMESH_POINT_ARRAY_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/type_vector.h"
+
+// C++ includes
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * An array of \p TypeVector values stored component by component
+ * ("structure of arrays"): all the x components, then all the y
+ * components, then all the z components.  Operations on the whole
+ * array are then loops over contiguous arrays of scalars, which the
+ * compiler can vectorize, rather than loops over short fixed size
+ * vectors.
+ *
+ * This is meant for batches of values at quadrature points, e.g. in
+ * \p FEMap, which converts from and to the usual
+ * \p std::vector<Point> storage.
+ *
+ * \brief Structure of arrays storage for vectors.
+ */
+template <typename T>
+class TypeVectorArray
+{
+public:
+  /**
+   * Constructs an empty array.
+   */
+  TypeVectorArray () : _size(0) {}
+
+  /**
+   * Constructs an array of \p n zero vectors.
+   */
+  explicit
+  TypeVectorArray (const std::size_t n) : _size(n), _data(LIBMESH_DIM*n) {}
+
+  /**
+   * \returns The number of vectors.
+   */
+  std::size_t size () const { return _size; }
+
+  /**
+   * Resizes to \p n vectors.  The values are invalidated.
+   */
+  void resize (const std::size_t n)
+  {
+    _size = n;
+    _data.resize(LIBMESH_DIM*n);
+  }
+
+  /**
+   * Sets all the vectors to zero.
+   */
+  void zero () { std::fill(_data.begin(), _data.end(), T(0)); }
+
+  /**
+   * \returns A pointer to the \p size() values of component \p i.
+   */
+  T * component (const unsigned int i)
+  {
+    libmesh_assert_less (i, LIBMESH_DIM);
+    return _data.empty() ? libmesh_nullptr : &_data[i*_size];
+  }
+
+  const T * component (const unsigned int i) const
+  {
+    libmesh_assert_less (i, LIBMESH_DIM);
+    return _data.empty() ? libmesh_nullptr : &_data[i*_size];
+  }
+
+  /**
+   * \returns A copy of vector \p p.
+   */
+  TypeVector<T> operator() (const std::size_t p) const
+  {
+    libmesh_assert_less (p, _size);
+    TypeVector<T> v;
+    for (unsigned int i=0; i != LIBMESH_DIM; ++i)
+      v(i) = _data[i*_size + p];
+    return v;
+  }
+
+  /**
+   * Sets vector \p p to \p v.
+   */
+  void set (const std::size_t p, const TypeVector<T> & v)
+  {
+    libmesh_assert_less (p, _size);
+    for (unsigned int i=0; i != LIBMESH_DIM; ++i)
+      _data[i*_size + p] = v(i);
+  }
+
+  /**
+   * Adds \p v scaled by \p weights[p] to each vector \p p.  This is
+   * the update for one node in the sums over mapping shape functions.
+   */
+  template <typename T2>
+  void add_scaled (const TypeVector<T2> & v, const Real * weights)
+  {
+    for (unsigned int i=0; i != LIBMESH_DIM; ++i)
+      {
+        T * c = this->component(i);
+        const T2 vi = v(i);
+        for (std::size_t p=0; p != _size; ++p)
+          c[p] += vi*weights[p];
+      }
+  }
+
+  /**
+   * Copies the vectors from \p in, resizing to fit.
+   */
+  template <typename V>
+  void assign (const std::vector<V> & in)
+  {
+    this->resize(in.size());
+    for (unsigned int i=0; i != LIBMESH_DIM; ++i)
+      {
+        T * c = this->component(i);
+        for (std::size_t p=0; p != _size; ++p)
+          c[p] = in[p](i);
+      }
+  }
+
+  /**
+   * Copies the vectors into \p out, which must already have \p
+   * size() entries.
+   */
+  template <typename V>
+  void copy_to (std::vector<V> & out) const
+  {
+    libmesh_assert_equal_to (out.size(), _size);
+    for (unsigned int i=0; i != LIBMESH_DIM; ++i)
+      {
+        const T * c = this->component(i);
+        for (std::size_t p=0; p != _size; ++p)
+          out[p](i) = c[p];
+      }
+  }
+
+private:
+  std::size_t _size;
+  std::vector<T> _data;
+};
+
+/**
+ * Arrays of points and of gradients.
+ */
+typedef TypeVectorArray<Real>   PointArray;
+typedef TypeVectorArray<Number> GradientArray;
+
+
+
+/**
+ * Sets \p result[p] to the dot product of \p a(p) and \p b(p).
+ */
+template <typename T>
+inline
+void dot (const TypeVectorArray<T> & a,
+          const TypeVectorArray<T> & b,
+          T * result)
+{
+  libmesh_assert_equal_to (a.size(), b.size());
+  const std::size_t n = a.size();
+
+  std::fill(result, result + n, T(0));
+  for (unsigned int i=0; i != LIBMESH_DIM; ++i)
+    {
+      const T * ai = a.component(i);
+      const T * bi = b.component(i);
+      for (std::size_t p=0; p != n; ++p)
+        result[p] += ai[p]*bi[p];
+    }
+}
+
+
+
+#if LIBMESH_DIM == 3
+/**
+ * Sets \p result(p) to the cross product of \p a(p) and \p b(p).
+ * \p result may not be either of the arguments.
+ */
+template <typename T>
+inline
+void cross (const TypeVectorArray<T> & a,
+            const TypeVectorArray<T> & b,
+            TypeVectorArray<T> & result)
+{
+  libmesh_assert_equal_to (a.size(), b.size());
+  libmesh_assert_not_equal_to (&result, &a);
+  libmesh_assert_not_equal_to (&result, &b);
+  const std::size_t n = a.size();
+  result.resize(n);
+
+  const T * a0 = a.component(0), * a1 = a.component(1), * a2 = a.component(2);
+  const T * b0 = b.component(0), * b1 = b.component(1), * b2 = b.component(2);
+  T * r0 = result.component(0), * r1 = result.component(1), * r2 = result.component(2);
+
+  for (std::size_t p=0; p != n; ++p)
+    {
+      r0[p] = a1[p]*b2[p] - a2[p]*b1[p];
+      r1[p] = a2[p]*b0[p] - a0[p]*b2[p];
+      r2[p] = a0[p]*b1[p] - a1[p]*b0[p];
+    }
+}
+
+
+
+/**
+ * Sets \p result[p] to the triple product a(p) . (b(p) x c(p)),
+ * i.e. the determinant of the matrix with rows \p a(p), \p b(p) and
+ * \p c(p).
+ */
+template <typename T>
+inline
+void triple_product (const TypeVectorArray<T> & a,
+                     const TypeVectorArray<T> & b,
+                     const TypeVectorArray<T> & c,
+                     T * result)
+{
+  libmesh_assert_equal_to (a.size(), b.size());
+  libmesh_assert_equal_to (a.size(), c.size());
+  const std::size_t n = a.size();
+
+  const T * a0 = a.component(0), * a1 = a.component(1), * a2 = a.component(2);
+  const T * b0 = b.component(0), * b1 = b.component(1), * b2 = b.component(2);
+  const T * c0 = c.component(0), * c1 = c.component(1), * c2 = c.component(2);
+
+  for (std::size_t p=0; p != n; ++p)
+    result[p] = (a0[p]*(b1[p]*c2[p] - b2[p]*c1[p]) +
+                 a1[p]*(b2[p]*c0[p] - b0[p]*c2[p]) +
+                 a2[p]*(b0[p]*c1[p] - b1[p]*c0[p]));
+}
+#endif // LIBMESH_DIM == 3
+
+} // namespace libMesh
+
+#endif // LIBMESH_POINT_ARRAY_H
@@ -71,6 +71,20 @@ public:
    */
   virtual numeric_index_type n () const = 0;
 
+  /**
+   * \returns The number of rows of the matrix stored on this
+   * processor, which the eigensolvers use to lay out their vectors.
+   * Defaults to \p m(), which is only right in serial.
+   */
+  virtual numeric_index_type local_m () const { return this->m(); }
+
+  /**
+   * \returns The number of columns of the matrix corresponding to
+   * the entries of a vector stored on this processor.  Defaults to
+   * \p n(), which is only right in serial.
+   */
+  virtual numeric_index_type local_n () const { return this->n(); }
+
   /**
    * Multiplies the matrix with \p arg and stores the result in \p
    * dest.
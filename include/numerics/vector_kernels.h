@@ -0,0 +1,333 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_VECTOR_KERNELS_H
+#define LIBMESH_VECTOR_KERNELS_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/libmesh.h"
+#include "libmesh/tensor_tools.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * The VectorKernels namespace contains threaded loops over
+ * contiguous arrays of vector entries, for the \p NumericVector
+ * implementations which store their local entries themselves.
+ *
+ * The arrays are split into fixed-size chunks which are processed
+ * with \p Threads::parallel_for.  Reductions store one partial result
+ * per chunk and sum those in order afterwards, so dot products and
+ * norms do not depend on the number of threads.  Short arrays, and
+ * calls made from within a threaded region, are processed serially.
+ */
+namespace VectorKernels
+{
+
+/**
+ * The number of entries per chunk.
+ */
+const std::size_t chunk_size = 4096;
+
+/**
+ * Arrays shorter than this are not worth handing to threads.
+ */
+const std::size_t min_threaded_size = 8*chunk_size;
+
+/**
+ * Implementation details, not for use outside this file.
+ */
+namespace Detail
+{
+inline
+bool use_threads (const std::size_t n)
+{
+  return n >= min_threaded_size &&
+    libMesh::n_threads() > 1 &&
+    !Threads::in_threads;
+}
+
+inline
+std::size_t n_chunks (const std::size_t n)
+{
+  return (n + chunk_size - 1) / chunk_size;
+}
+
+/**
+ * Runs \p op(chunk, first, last) over each chunk of [0, n), threaded when
+ * worthwhile.  The chunk boundaries do not depend on the number of
+ * threads.
+ */
+template <typename Op>
+struct ChunkLoop
+{
+  ChunkLoop (const Op & op_in, const std::size_t n_in) :
+    op(op_in), n(n_in) {}
+
+  void operator() (const Threads::BlockedRange<std::size_t> & range) const
+  {
+    for (std::size_t c = range.begin(); c != range.end(); ++c)
+      {
+        const std::size_t first = c*chunk_size;
+        const std::size_t last = std::min(first + chunk_size, n);
+        op(c, first, last);
+      }
+  }
+
+  const Op & op;
+  const std::size_t n;
+};
+
+template <typename Op>
+inline
+void for_each_chunk (const Op & op, const std::size_t n)
+{
+  const std::size_t nc = n_chunks(n);
+
+  if (use_threads(n))
+    Threads::parallel_for (Threads::BlockedRange<std::size_t>(0, nc, 1),
+                           ChunkLoop<Op>(op, n));
+  else
+    ChunkLoop<Op>(op, n)(Threads::BlockedRange<std::size_t>(0, nc, 1));
+}
+
+template <typename T>
+struct Axpy
+{
+  T a; const T * x; T * y;
+  void operator() (std::size_t, std::size_t first, std::size_t last) const
+  { for (std::size_t i=first; i != last; ++i) y[i] += a*x[i]; }
+};
+
+template <typename T>
+struct Waxpby
+{
+  T a; const T * x; T b; const T * y; T * w;
+  void operator() (std::size_t, std::size_t first, std::size_t last) const
+  { for (std::size_t i=first; i != last; ++i) w[i] = a*x[i] + b*y[i]; }
+};
+
+template <typename T>
+struct Maxpy
+{
+  std::size_t m; const T * a; const T * const * x; T * y;
+  void operator() (std::size_t, std::size_t first, std::size_t last) const
+  {
+    for (std::size_t i=first; i != last; ++i)
+      {
+        T sum = y[i];
+        for (std::size_t k=0; k != m; ++k)
+          sum += a[k]*x[k][i];
+        y[i] = sum;
+      }
+  }
+};
+
+template <typename T>
+struct Scale
+{
+  T a; T * x;
+  void operator() (std::size_t, std::size_t first, std::size_t last) const
+  { for (std::size_t i=first; i != last; ++i) x[i] *= a; }
+};
+
+template <typename T>
+struct PointwiseMult
+{
+  const T * x; const T * y; T * z;
+  void operator() (std::size_t, std::size_t first, std::size_t last) const
+  { for (std::size_t i=first; i != last; ++i) z[i] = x[i]*y[i]; }
+};
+
+template <typename T>
+struct Dot
+{
+  const T * x; const T * y; T * partial;
+  void operator() (std::size_t c, std::size_t first, std::size_t last) const
+  {
+    T sum = 0;
+    for (std::size_t i=first; i != last; ++i)
+      sum += x[i]*y[i];
+    partial[c] = sum;
+  }
+};
+
+template <typename T>
+struct MDot
+{
+  std::size_t m; const T * x; const T * const * y; T * partial;
+  void operator() (std::size_t c, std::size_t first, std::size_t last) const
+  {
+    T * sums = partial + c*m;
+    for (std::size_t i=first; i != last; ++i)
+      for (std::size_t k=0; k != m; ++k)
+        sums[k] += x[i]*y[k][i];
+  }
+};
+
+template <typename T>
+struct NormSq
+{
+  const T * x; Real * partial;
+  void operator() (std::size_t c, std::size_t first, std::size_t last) const
+  {
+    Real sum = 0;
+    for (std::size_t i=first; i != last; ++i)
+      sum += TensorTools::norm_sq(x[i]);
+    partial[c] = sum;
+  }
+};
+
+template <typename R>
+inline
+R ordered_sum (const std::vector<R> & partial)
+{
+  R sum = 0;
+  for (std::size_t c=0; c != partial.size(); ++c)
+    sum += partial[c];
+  return sum;
+}
+} // namespace Detail
+
+
+
+/**
+ * y += a*x
+ */
+template <typename T>
+inline
+void axpy (const std::size_t n, const T a, const T * x, T * y)
+{
+  const Detail::Axpy<T> op = {a, x, y};
+  Detail::for_each_chunk(op, n);
+}
+
+/**
+ * w = a*x + b*y; \p w may alias \p x or \p y.
+ */
+template <typename T>
+inline
+void waxpby (const std::size_t n, const T a, const T * x,
+             const T b, const T * y, T * w)
+{
+  const Detail::Waxpby<T> op = {a, x, b, y, w};
+  Detail::for_each_chunk(op, n);
+}
+
+/**
+ * y += sum_k a[k]*x[k], in a single pass over \p y.
+ */
+template <typename T>
+inline
+void maxpy (const std::size_t n, const std::size_t m,
+            const T * a, const T * const * x, T * y)
+{
+  const Detail::Maxpy<T> op = {m, a, x, y};
+  Detail::for_each_chunk(op, n);
+}
+
+/**
+ * x *= a
+ */
+template <typename T>
+inline
+void scale (const std::size_t n, const T a, T * x)
+{
+  const Detail::Scale<T> op = {a, x};
+  Detail::for_each_chunk(op, n);
+}
+
+/**
+ * z = x .* y; \p z may alias \p x or \p y.
+ */
+template <typename T>
+inline
+void pointwise_mult (const std::size_t n, const T * x, const T * y, T * z)
+{
+  const Detail::PointwiseMult<T> op = {x, y, z};
+  Detail::for_each_chunk(op, n);
+}
+
+/**
+ * \returns sum_i x[i]*y[i], without conjugation, summed in an order
+ * which does not depend on the number of threads.
+ */
+template <typename T>
+inline
+T dot (const std::size_t n, const T * x, const T * y)
+{
+  std::vector<T> partial (Detail::n_chunks(n), 0);
+  if (partial.empty())
+    return 0;
+  const Detail::Dot<T> op = {x, y, &partial[0]};
+  Detail::for_each_chunk(op, n);
+  return Detail::ordered_sum(partial);
+}
+
+/**
+ * Sets dots[k] = sum_i x[i]*y[k][i] for each of the \p m arrays
+ * \p y[k], without conjugation, in a single pass over \p x.  The
+ * summation order does not depend on the number of threads.
+ */
+template <typename T>
+inline
+void mdot (const std::size_t n, const std::size_t m,
+           const T * x, const T * const * y, T * dots)
+{
+  std::fill(dots, dots + m, T(0));
+  const std::size_t nc = Detail::n_chunks(n);
+  if (!nc || !m)
+    return;
+  std::vector<T> partial (nc*m, 0);
+  const Detail::MDot<T> op = {m, x, y, &partial[0]};
+  Detail::for_each_chunk(op, n);
+  for (std::size_t c=0; c != nc; ++c)
+    for (std::size_t k=0; k != m; ++k)
+      dots[k] += partial[c*m + k];
+}
+
+/**
+ * \returns sum_i |x[i]|^2, summed in an order which does not depend
+ * on the number of threads.
+ */
+template <typename T>
+inline
+Real norm_sq (const std::size_t n, const T * x)
+{
+  std::vector<Real> partial (Detail::n_chunks(n), 0);
+  if (partial.empty())
+    return 0;
+  const Detail::NormSq<T> op = {x, &partial[0]};
+  Detail::for_each_chunk(op, n);
+  return Detail::ordered_sum(partial);
+}
+
+} // namespace VectorKernels
+
+} // namespace libMesh
+
+#endif // LIBMESH_VECTOR_KERNELS_H
@@ -675,6 +675,22 @@ public:
    */
   void split(int color, int key, Communicator & target) const;
 
+  /*
+   * Create a new communicator between the processors of \p this
+   * which share memory with this one, i.e. which run on the same
+   * node.  Without MPI-3 every processor is taken to be a node of
+   * its own.
+   */
+  void split_by_node(Communicator & target) const;
+
+  /*
+   * Create a new communicator between the processors of \p this
+   * which are numbered the same in their node's split_by_node()
+   * communicator, i.e. one processor from each node.  On the
+   * processors numbered 0 this is the communicator between nodes.
+   */
+  void split_across_nodes(Communicator & target) const;
+
   /*
    * Create a new duplicate of \p this communicator
    */
@@ -747,6 +763,10 @@ private:
   mutable std::map<int, unsigned int> used_tag_values;
   bool          _I_duped_it;
 
+  // The number of sparse_exchange() calls so far, which picks their
+  // tags
+  mutable unsigned int _n_sparse_exchanges;
+
   // Communication operations:
 public:
 
@@ -1298,6 +1318,19 @@ public:
   template <typename T>
   inline void alltoall(std::vector<T> & r) const;
 
+  /**
+   * Sends each vector in \p data to the processor it is keyed by,
+   * and fills \p received with the vectors sent to this processor,
+   * keyed by their senders.  Nobody needs to know in advance who
+   * sends to whom: with MPI-3 this is a nonblocking consensus of
+   * synchronous sends and a nonblocking barrier, so that its cost on
+   * each processor grows with the number of processors it exchanges
+   * data with rather than with the size of the communicator.
+   */
+  template <typename T>
+  inline void sparse_exchange(const std::map<unsigned int, std::vector<T> > & data,
+                              std::map<unsigned int, std::vector<T> > & received) const;
+
   /**
    * Take a local value and broadcast it to all processors.
    * Optionally takes the \p root_id processor, which specifies
@@ -1325,6 +1358,10 @@ public:
    * unsigned int Parallel::packed_size(const T *,
    *                                    vector<int>::const_iterator)
    * is used to advance to the beginning of the next object's data.
+   *
+   * The range is streamed in chunks of roughly \p approx_buffer_size
+   * buffer entries, each unpacked on arrival, so no processor ever
+   * holds more than one chunk of packed data.
    */
   template <typename Context, typename OutputContext, typename Iter, typename OutputIter>
   inline void broadcast_packed_range (const Context * context1,
@@ -1332,7 +1369,8 @@ public:
                                       const Iter range_end,
                                       OutputContext * context2,
                                       OutputIter out,
-                                      const unsigned int root_id = 0) const;
+                                      const unsigned int root_id = 0,
+                                      std::size_t approx_buffer_size = 1000000) const;
 
   /**
    * C++ doesn't let us partially specialize functions (we're really
@@ -173,6 +173,106 @@ struct SyncEverything
 };
 
 
+namespace detail {
+
+// Sends and receives std::vector data, flattening vectors of vectors,
+// which some sync functors use as their datum, on the way.
+template <typename T>
+void send_vector (const Communicator & comm,
+                  const processor_id_type dest,
+                  const std::vector<T> & buf)
+{
+  comm.send(dest, buf);
+}
+
+template <typename T>
+void send_vector (const Communicator & comm,
+                  const processor_id_type dest,
+                  const std::vector<std::vector<T> > & buf)
+{
+  std::vector<unsigned int> sizes(buf.size());
+  std::vector<T> flat;
+  for (std::size_t i=0; i != buf.size(); ++i)
+    {
+      sizes[i] = cast_int<unsigned int>(buf[i].size());
+      flat.insert(flat.end(), buf[i].begin(), buf[i].end());
+    }
+  comm.send(dest, sizes);
+  comm.send(dest, flat);
+}
+
+template <typename T>
+void receive_vector (const Communicator & comm,
+                     const processor_id_type source,
+                     std::vector<T> & buf)
+{
+  comm.receive(source, buf);
+}
+
+template <typename T>
+void receive_vector (const Communicator & comm,
+                     const processor_id_type source,
+                     std::vector<std::vector<T> > & buf)
+{
+  std::vector<unsigned int> sizes;
+  std::vector<T> flat;
+  comm.receive(source, sizes);
+  comm.receive(source, flat);
+
+  buf.resize(sizes.size());
+  typename std::vector<T>::const_iterator it = flat.begin();
+  for (std::size_t i=0; i != sizes.size(); ++i)
+    {
+      buf[i].assign(it, it + sizes[i]);
+      it += sizes[i];
+    }
+  libmesh_assert(it == flat.end());
+}
+
+/**
+ * Does comm.send_receive(dest, send, source, recv), except that the
+ * message to \p dest is only sent if \p do_send and the one from \p
+ * source is only received if \p do_recv, so that processors which
+ * have nothing to trade don't trade empty messages.  Both ends of
+ * each message have to agree on whether it exists.
+ */
+template <typename T1, typename T2>
+void send_receive_if (const Communicator & comm,
+                      const processor_id_type dest,
+                      const std::vector<T1> & send,
+                      const bool do_send,
+                      const processor_id_type source,
+                      std::vector<T2> & recv,
+                      const bool do_recv)
+{
+  if (do_send && do_recv)
+    comm.send_receive(dest, send, source, recv);
+  else if (do_send)
+    send_vector(comm, dest, send);
+  else if (do_recv)
+    receive_vector(comm, source, recv);
+}
+
+/**
+ * \returns The number of objects each processor asks us about,
+ * given the \p requests we have for each processor, with one
+ * all-to-all exchange of the counts.
+ */
+template <typename T>
+std::vector<dof_id_type>
+count_requests (const Communicator & comm,
+                const std::vector<std::vector<T> > & requests)
+{
+  std::vector<dof_id_type> counts(comm.size());
+  for (processor_id_type p=0; p != comm.size(); ++p)
+    counts[p] = cast_int<dof_id_type>(requests[p].size());
+  comm.alltoall(counts);
+  return counts;
+}
+
+} // namespace detail
+
+
 
 template <typename Iterator,
           typename DofObjType,
@@ -240,6 +340,11 @@ void sync_dofobject_data_by_xyz(const Communicator & comm,
       requested_objs_id[obj_procid].push_back(obj->id());
     }
 
+  // Only trade with the processors we have requests for, or which
+  // have requests for us
+  const std::vector<dof_id_type> requests_from_proc =
+    detail::count_requests(comm, requested_objs_id);
+
   // Trade requests with other processors
   for (processor_id_type p=1; p != comm.size(); ++p)
     {
@@ -251,15 +356,20 @@ void sync_dofobject_data_by_xyz(const Communicator & comm,
         cast_int<processor_id_type>
         ((comm.size() + comm.rank() - p) %
          comm.size());
+      const bool need_up = !requested_objs_id[procup].empty();
+      const bool need_down = (requests_from_proc[procdown] != 0);
+      if (!need_up && !need_down)
+        continue;
+
       std::vector<Real> request_to_fill_x,
         request_to_fill_y,
         request_to_fill_z;
-      comm.send_receive(procup, requested_objs_x[procup],
-                        procdown, request_to_fill_x);
-      comm.send_receive(procup, requested_objs_y[procup],
-                        procdown, request_to_fill_y);
-      comm.send_receive(procup, requested_objs_z[procup],
-                        procdown, request_to_fill_z);
+      detail::send_receive_if(comm, procup, requested_objs_x[procup], need_up,
+                              procdown, request_to_fill_x, need_down);
+      detail::send_receive_if(comm, procup, requested_objs_y[procup], need_up,
+                              procdown, request_to_fill_y, need_down);
+      detail::send_receive_if(comm, procup, requested_objs_z[procup], need_up,
+                              procdown, request_to_fill_z, need_down);
 
       // Find the local id of each requested object
       std::vector<dof_id_type> request_to_fill_id(request_to_fill_x.size());
@@ -286,8 +396,8 @@ void sync_dofobject_data_by_xyz(const Communicator & comm,
 
       // Trade back the results
       std::vector<typename SyncFunctor::datum> received_data;
-      comm.send_receive(procdown, data,
-                        procup, received_data);
+      detail::send_receive_if(comm, procdown, data, need_down,
+                              procup, received_data, need_up);
       libmesh_assert_equal_to (requested_objs_x[procup].size(),
                                received_data.size());
 
@@ -365,6 +475,11 @@ void sync_dofobject_data_by_id(const Communicator & comm,
       requested_objs_id[obj_procid].push_back(obj->id());
     }
 
+  // Only trade with the processors we have requests for, or which
+  // have requests for us
+  const std::vector<dof_id_type> requests_from_proc =
+    detail::count_requests(comm, requested_objs_id);
+
   // Trade requests with other processors
   for (processor_id_type p=1; p != comm.size(); ++p)
     {
@@ -376,9 +491,14 @@ void sync_dofobject_data_by_id(const Communicator & comm,
         cast_int<processor_id_type>
         ((comm.size() + comm.rank() - p) %
          comm.size());
+      const bool need_up = !requested_objs_id[procup].empty();
+      const bool need_down = (requests_from_proc[procdown] != 0);
+      if (!need_up && !need_down)
+        continue;
+
       std::vector<dof_id_type> request_to_fill_id;
-      comm.send_receive(procup, requested_objs_id[procup],
-                        procdown, request_to_fill_id);
+      detail::send_receive_if(comm, procup, requested_objs_id[procup], need_up,
+                              procdown, request_to_fill_id, need_down);
 
       // Gather whatever data the user wants
       std::vector<typename SyncFunctor::datum> data;
@@ -386,8 +506,8 @@ void sync_dofobject_data_by_id(const Communicator & comm,
 
       // Trade back the results
       std::vector<typename SyncFunctor::datum> received_data;
-      comm.send_receive(procdown, data,
-                        procup, received_data);
+      detail::send_receive_if(comm, procdown, data, need_down,
+                              procup, received_data, need_up);
       libmesh_assert_equal_to (requested_objs_id[procup].size(),
                                received_data.size());
 
@@ -460,6 +580,11 @@ void sync_element_data_by_parent_id(MeshBase &       mesh,
          (parent->which_child_am_i(elem)));
     }
 
+  // Only trade with the processors we have requests for, or which
+  // have requests for us
+  const std::vector<dof_id_type> requests_from_proc =
+    detail::count_requests(comm, requested_objs_id);
+
   // Trade requests with other processors
   for (processor_id_type p=1; p != comm.size(); ++p)
     {
@@ -471,12 +596,17 @@ void sync_element_data_by_parent_id(MeshBase &       mesh,
         cast_int<processor_id_type>
         ((comm.size() + comm.rank() - p) %
          comm.size());
+      const bool need_up = !requested_objs_id[procup].empty();
+      const bool need_down = (requests_from_proc[procdown] != 0);
+      if (!need_up && !need_down)
+        continue;
+
       std::vector<dof_id_type>   request_to_fill_parent_id;
       std::vector<unsigned char> request_to_fill_child_num;
-      comm.send_receive(procup, requested_objs_parent_id[procup],
-                        procdown, request_to_fill_parent_id);
-      comm.send_receive(procup, requested_objs_child_num[procup],
-                        procdown, request_to_fill_child_num);
+      detail::send_receive_if(comm, procup, requested_objs_parent_id[procup], need_up,
+                              procdown, request_to_fill_parent_id, need_down);
+      detail::send_receive_if(comm, procup, requested_objs_child_num[procup], need_up,
+                              procdown, request_to_fill_child_num, need_down);
 
       // Find the id of each requested element
       std::size_t request_size = request_to_fill_parent_id.size();
@@ -497,8 +627,8 @@ void sync_element_data_by_parent_id(MeshBase &       mesh,
 
       // Trade back the results
       std::vector<typename SyncFunctor::datum> received_data;
-      comm.send_receive(procdown, data,
-                        procup, received_data);
+      detail::send_receive_if(comm, procdown, data, need_down,
+                              procup, received_data, need_up);
       libmesh_assert_equal_to (requested_objs_id[procup].size(),
                                received_data.size());
 
@@ -634,6 +764,11 @@ void sync_node_data_by_element_id(MeshBase &       mesh,
             }
         }
 
+      // Only trade with the processors we have requests for, or
+      // which have requests for us
+      const std::vector<dof_id_type> requests_from_proc =
+        detail::count_requests(comm, requested_objs_id);
+
       // Trade requests with other processors
       for (processor_id_type p=1; p != comm.size(); ++p)
         {
@@ -645,6 +780,10 @@ void sync_node_data_by_element_id(MeshBase &       mesh,
             cast_int<processor_id_type>
             ((comm.size() + comm.rank() - p) %
              comm.size());
+          const bool need_up = !requested_objs_id[procup].empty();
+          const bool need_down = (requests_from_proc[procdown] != 0);
+          if (!need_up && !need_down)
+            continue;
 
           libmesh_assert_equal_to (requested_objs_id[procup].size(),
                                    ghost_objects_from_proc[procup]);
@@ -655,10 +794,10 @@ void sync_node_data_by_element_id(MeshBase &       mesh,
 
           std::vector<dof_id_type>   request_to_fill_elem_id;
           std::vector<unsigned char> request_to_fill_node_num;
-          comm.send_receive(procup, requested_objs_elem_id[procup],
-                            procdown, request_to_fill_elem_id);
-          comm.send_receive(procup, requested_objs_node_num[procup],
-                            procdown, request_to_fill_node_num);
+          detail::send_receive_if(comm, procup, requested_objs_elem_id[procup], need_up,
+                                  procdown, request_to_fill_elem_id, need_down);
+          detail::send_receive_if(comm, procup, requested_objs_node_num[procup], need_up,
+                                  procdown, request_to_fill_node_num, need_down);
 
           // Find the id of each requested element
           std::size_t request_size = request_to_fill_elem_id.size();
@@ -685,8 +824,8 @@ void sync_node_data_by_element_id(MeshBase &       mesh,
 
           // Trade back the results
           std::vector<typename SyncFunctor::datum> received_data;
-          comm.send_receive(procdown, data,
-                            procup, received_data);
+          detail::send_receive_if(comm, procdown, data, need_down,
+                                  procup, received_data, need_up);
           libmesh_assert_equal_to (requested_objs_elem_id[procup].size(),
                                    received_data.size());
 
@@ -622,7 +622,8 @@ inline Communicator::Communicator () :
   _size(1),
   _send_mode(DEFAULT),
   used_tag_values(),
-  _I_duped_it(false) {}
+  _I_duped_it(false),
+  _n_sparse_exchanges(0) {}
 
 inline Communicator::Communicator (const communicator & comm) :
 #ifdef LIBMESH_HAVE_MPI
@@ -632,7 +633,8 @@ inline Communicator::Communicator (const communicator & comm) :
   _size(1),
   _send_mode(DEFAULT),
   used_tag_values(),
-  _I_duped_it(false)
+  _I_duped_it(false),
+  _n_sparse_exchanges(0)
 {
   this->assign(comm);
 }
@@ -654,11 +656,46 @@ inline void Communicator::split(int color, int key, Communicator & target) const
   target._I_duped_it = true;
   target.send_mode(this->send_mode());
 }
+
+inline void Communicator::split_by_node(Communicator & target) const
+{
+#if MPI_VERSION > 2
+  target.clear();
+  MPI_Comm newcomm;
+  libmesh_call_mpi
+    (MPI_Comm_split_type(this->get(), MPI_COMM_TYPE_SHARED,
+                         this->rank(), MPI_INFO_NULL, &newcomm));
+
+  target.assign(newcomm);
+  target._I_duped_it = true;
+  target.send_mode(this->send_mode());
+#else
+  this->split(this->rank(), 0, target);
+#endif
+}
+
+inline void Communicator::split_across_nodes(Communicator & target) const
+{
+  Communicator node_comm;
+  this->split_by_node(node_comm);
+
+  this->split(node_comm.rank(), this->rank(), target);
+}
 #else
 inline void Communicator::split(int, int, Communicator & target) const
 {
   target.assign(this->get());
 }
+
+inline void Communicator::split_by_node(Communicator & target) const
+{
+  target.assign(this->get());
+}
+
+inline void Communicator::split_across_nodes(Communicator & target) const
+{
+  target.assign(this->get());
+}
 #endif
 
 inline void Communicator::duplicate(const Communicator & comm)
@@ -713,7 +750,8 @@ inline Communicator::Communicator (const Communicator &) :
   _size(1),
   _send_mode(DEFAULT),
   used_tag_values(),
-  _I_duped_it(false)
+  _I_duped_it(false),
+  _n_sparse_exchanges(0)
 {
   libmesh_not_implemented();
 }
@@ -744,6 +782,7 @@ inline void Communicator::assign(const communicator & comm)
     }
 #endif
   _send_mode = DEFAULT;
+  _n_sparse_exchanges = 0;
 }
 
 
@@ -2358,11 +2397,15 @@ inline void Communicator::send_packed_range (const unsigned int dest_processor_i
   std::size_t used_buffer_size = 0;
 #endif
 
+  // The blocking sends are done with each chunk by the time we pack
+  // the next one, so they can all share one buffer's storage
+  std::vector<typename Parallel::Packing<T>::buffer_type> buffer;
+
   while (range_begin != range_end)
     {
       libmesh_assert_greater (std::distance(range_begin, range_end), 0);
 
-      std::vector<typename Parallel::Packing<T>::buffer_type> buffer;
+      buffer.clear();
 
       const Iter next_range_begin = Parallel::pack_range
         (context, range_begin, range_end, buffer);
@@ -2753,10 +2796,13 @@ inline void Communicator::receive_packed_range (const unsigned int src_processor
   // src_processor_id is or tag is "any" then we want to be sure we
   // try to receive messages all corresponding to the same send.
 
+  // Every chunk is unpacked before the next arrives, so they can all
+  // share one buffer's storage
+  std::vector<buffer_t> buffer;
+
   std::size_t received_buffer_size = 0;
   while (received_buffer_size < total_buffer_size)
     {
-      std::vector<buffer_t> buffer;
       this->receive(stat.source(), buffer, MessageTag(stat.tag()));
       received_buffer_size += buffer.size();
       Parallel::unpack_range
@@ -3497,6 +3543,133 @@ inline void Communicator::alltoall(std::vector<T> & buf) const
 
 
 
+template <typename T>
+inline void Communicator::sparse_exchange
+  (const std::map<unsigned int, std::vector<T> > & data,
+   std::map<unsigned int, std::vector<T> > & received) const
+{
+  LOG_SCOPE("sparse_exchange()", "Parallel");
+
+  typedef typename std::map<unsigned int, std::vector<T> >::const_iterator iterator;
+
+  received.clear();
+
+  // Processors which finish an exchange early may start the next one
+  // while others are still probing for messages of this one, so
+  // consecutive exchanges use different tags.  Two suffice: once we
+  // have finished an exchange everyone has started it, and so has
+  // finished the one before.
+  const MessageTag tag =
+    this->get_unique_tag(5401 + (_n_sparse_exchanges++ % 2));
+
+#if MPI_VERSION > 2
+  // Synchronous sends only complete once they have been matched, so
+  // once all of ours have, everything we sent has been received...
+  std::vector<MPI_Request> sends;
+  sends.reserve(data.size());
+
+  for (iterator it = data.begin(); it != data.end(); ++it)
+    {
+      if (it->first == this->rank())
+        {
+          received[it->first] = it->second;
+          continue;
+        }
+
+      const std::vector<T> & buf = it->second;
+      const T * ptr = buf.empty() ? libmesh_nullptr : &buf[0];
+
+      sends.push_back(MPI_REQUEST_NULL);
+      libmesh_call_mpi
+        (MPI_Issend (const_cast<T *>(ptr), cast_int<int>(buf.size()),
+                     StandardType<T>(ptr), it->first, tag.value(),
+                     this->get(), &sends.back()));
+    }
+
+  // ... and once everyone's have, as the barrier tells us, nothing is
+  // left in flight.  Until then keep receiving.
+  MPI_Request barrier = MPI_REQUEST_NULL;
+  bool barrier_started = false;
+
+  while (true)
+    {
+      int flag = 0;
+      MPI_Status status;
+      libmesh_call_mpi
+        (MPI_Iprobe (MPI_ANY_SOURCE, tag.value(), this->get(),
+                     &flag, &status));
+
+      if (flag)
+        {
+          const unsigned int source =
+            cast_int<unsigned int>(status.MPI_SOURCE);
+          libmesh_assert (!received.count(source));
+          this->receive(source, received[source], tag);
+        }
+
+      if (barrier_started)
+        {
+          int done = 0;
+          libmesh_call_mpi
+            (MPI_Test (&barrier, &done, MPI_STATUS_IGNORE));
+          if (done)
+            break;
+        }
+      else
+        {
+          int sent = 0;
+          libmesh_call_mpi
+            (MPI_Testall (cast_int<int>(sends.size()),
+                          sends.empty() ? libmesh_nullptr : &sends[0],
+                          &sent, MPI_STATUSES_IGNORE));
+          if (sent)
+            {
+              libmesh_call_mpi
+                (MPI_Ibarrier (this->get(), &barrier));
+              barrier_started = true;
+            }
+        }
+    }
+#else
+  // Without a nonblocking barrier, tell everyone what to expect
+  std::vector<unsigned int> sending_to(this->size(), 0);
+  for (iterator it = data.begin(); it != data.end(); ++it)
+    sending_to[it->first] = 1;
+  sending_to[this->rank()] = 0;
+
+  this->alltoall(sending_to);
+
+  std::vector<Request> sends;
+  sends.reserve(data.size());
+  for (iterator it = data.begin(); it != data.end(); ++it)
+    {
+      if (it->first == this->rank())
+        {
+          received[it->first] = it->second;
+          continue;
+        }
+
+      sends.push_back(Request());
+      this->send(it->first, it->second, sends.back(), tag);
+    }
+
+  unsigned int n_receives = 0;
+  for (unsigned int p=0; p != this->size(); ++p)
+    n_receives += sending_to[p];
+
+  for (unsigned int r=0; r != n_receives; ++r)
+    {
+      std::vector<T> buf;
+      Status stat = this->receive(any_source, buf, tag);
+      received[cast_int<unsigned int>(stat.source())].swap(buf);
+    }
+
+  Parallel::wait(sends);
+#endif
+}
+
+
+
 template <typename T>
 inline void Communicator::broadcast (T & data, const unsigned int root_id) const
 {
@@ -3763,20 +3936,24 @@ inline void Communicator::broadcast_packed_range(const Context * context1,
                                                  const Iter range_end,
                                                  OutputContext * context2,
                                                  OutputIter out_iter,
-                                                 const unsigned int root_id) const
+                                                 const unsigned int root_id,
+                                                 std::size_t approx_buffer_size) const
 {
   typedef typename std::iterator_traits<Iter>::value_type T;
   typedef typename Parallel::Packing<T>::buffer_type buffer_t;
 
+  // We will serialize variable size objects from *range_begin to
+  // *range_end as a sequence of ints in this buffer, one chunk at a
+  // time.  The buffer is reused so its memory is only allocated once.
+  std::vector<buffer_t> buffer;
+
   do
     {
-      // We will serialize variable size objects from *range_begin to
-      // *range_end as a sequence of ints in this buffer
-      std::vector<buffer_t> buffer;
+      buffer.clear();
 
       if (this->rank() == root_id)
         range_begin = Parallel::pack_range
-          (context1, range_begin, range_end, buffer);
+          (context1, range_begin, range_end, buffer, approx_buffer_size);
 
       // this->broadcast(vector) requires the receiving vectors to
       // already be the appropriate size
@@ -4039,6 +4216,14 @@ inline void Communicator::allgather(const T & send_val,
   recv_val[0] = send_val;
 }
 
+template <typename T>
+inline void Communicator::allgather(const std::basic_string<T> & sendval,
+                                    std::vector<std::basic_string<T> > & recv,
+                                    const bool) const
+{
+  recv.assign(1, sendval);
+}
+
 template <typename T>
 inline void Communicator::allgather(std::vector<T> &,
                                     const bool) const {}
@@ -4091,6 +4276,17 @@ inline void Communicator::scatter(const std::vector<std::vector<T> > & data,
 template <typename T>
 inline void Communicator::alltoall(std::vector<T> &) const {}
 
+template <typename T>
+inline void Communicator::sparse_exchange
+  (const std::map<unsigned int, std::vector<T> > & data,
+   std::map<unsigned int, std::vector<T> > & received) const
+{
+  // We can only send to ourselves
+  libmesh_assert_less_equal (data.size(), 1u);
+
+  received = data;
+}
+
 template <typename T>
 inline void Communicator::broadcast (T &,
                                      const unsigned int root_id) const
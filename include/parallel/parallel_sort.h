@@ -80,6 +80,15 @@ public:
    */
   const std::vector<KeyType> & bin();
 
+  /**
+   * Chooses between sample sort (the default) and the older
+   * histogram-based bin sort.  The sample sort picks its splitters
+   * from a few regular samples of each processor's sorted data and
+   * exchanges the keys in a single sparse communication; the bin sort
+   * refines global histograms and gathers each bin separately.
+   */
+  void use_sample_sort (bool sample_sort) { _use_sample_sort = sample_sort; }
+
 private:
 
   /**
@@ -119,6 +128,18 @@ private:
    */
   std::vector<KeyType> _my_bin;
 
+  /**
+   * Whether to sort with \p samplesort() rather than \p binsort().
+   */
+  bool _use_sample_sort;
+
+  /**
+   * Splits the local data among the processors at splitters chosen
+   * from regular samples of every processor's data, and sends each
+   * processor its keys with one sparse exchange.
+   */
+  void samplesort ();
+
   /**
    * Sorts the local data into bins across all processors.
    * Right now it constructs a BenSorter<KeyType> object.
@@ -136,8 +157,8 @@ private:
 
   /**
    * After all the bins have been communicated, we can
-   * sort our local bin.  This is nothing more than a
-   * call to std::sort
+   * sort our local bin.  Hilbert keys are radix sorted;
+   * anything else is sorted with std::sort
    */
   void sort_local_bin();
 
@@ -168,6 +168,19 @@ public:
     _grainsize(r._grainsize)
   {}
 
+  /**
+   * Copy constructor which sets the beginning and ending of the new
+   * range to be different from that of the one we're copying.  This
+   * is required by the pthread implementation of \p parallel_for.
+   */
+  BlockedRange (const BlockedRange<T> & r,
+                const const_iterator first,
+                const const_iterator last):
+    _end(last),
+    _begin(first),
+    _grainsize(r._grainsize)
+  {}
+
   /**
    * Splits the range \p r.  The first half
    * of the range is left in place, the second
@@ -33,6 +33,7 @@
 // C++ includes
 #include <memory> // for std::allocator
 #include <cstddef>
+#include <utility> // for std::forward
 
 namespace libMesh
 {
@@ -123,6 +124,55 @@ public:
 
 #endif // #ifdef LIBMESH_HAVE_TBB_API
 
+
+
+//-------------------------------------------------------------------
+/**
+ * Allocator whose containers default-initialize rather than
+ * value-initialize the elements they grow by, so that resizing a
+ * container of plain data doesn't write to it.  The pages of a large
+ * array are then placed, on NUMA machines, next to whichever thread
+ * first writes them, which lets arrays processed by threads be
+ * initialized by those same threads (see libMesh::numa_first_touch()).
+ * Without C++11 containers value-initialize as usual.
+ */
+template <typename T>
+class first_touch_allocator : public std::allocator<T>
+{
+public:
+  typedef T * pointer;
+  typedef const T * const_pointer;
+  typedef T value_type;
+  typedef size_t size_type;
+  typedef ptrdiff_t difference_type;
+
+  template<typename U>
+  struct rebind
+  {
+    typedef first_touch_allocator<U> other;
+  };
+
+  first_touch_allocator () :
+    std::allocator<T>() {}
+
+  first_touch_allocator (const first_touch_allocator & a) :
+    std::allocator<T>(a) {}
+
+  template<typename U>
+  first_touch_allocator(const first_touch_allocator<U> & a) :
+    std::allocator<T>(a) {}
+
+#ifdef LIBMESH_HAVE_CXX11
+  template<typename U>
+  void construct (U * p)
+  { ::new (static_cast<void *>(p)) U; }
+
+  template<typename U, typename... Args>
+  void construct (U * p, Args &&... args)
+  { ::new (static_cast<void *>(p)) U(std::forward<Args>(args)...); }
+#endif
+};
+
 } // namespace Threads
 
 } // namespace libMesh
@@ -33,9 +33,15 @@
 
 #include "libmesh/libmesh_logging.h"
 #include <pthread.h>
+#include <stdint.h>
 #include <algorithm>
+#include <atomic>
 #include <vector>
 
+#ifdef LIBMESH_HAVE_OPENMP
+#  include <omp.h>
+#endif
+
 #ifdef __APPLE__
 #  ifdef __MAC_10_12
 #    include <os/lock.h>
@@ -213,135 +219,379 @@ private:
 template <typename Range>
 unsigned int num_pthreads(Range & range)
 {
-  unsigned int min = std::min((std::size_t)libMesh::n_threads(), range.size());
+  unsigned int min = std::min((std::size_t)libMesh::n_threads(), static_cast<std::size_t>(range.size()));
   return min > 0 ? min : 1;
 }
 
-template <typename Range, typename Body>
-class RangeBody
+//-------------------------------------------------------------------
+/**
+ * Dummy "splitting object" used to distinguish splitting constructors
+ * from copy constructors.
+ */
+class split {};
+
+
+
+//-------------------------------------------------------------------
+/**
+ * Work-stealing pool of worker threads used by the pthread
+ * implementations of \p parallel_for and \p parallel_reduce.
+ *
+ * A parallel region is described by a number of independent chunks.
+ * Each participating thread starts out owning a contiguous block of
+ * chunk indices which it consumes from the front.  A thread which runs
+ * out of work steals the back half of another thread's block, so an
+ * unlucky thread holding expensive elements no longer dictates the
+ * runtime of the whole region.  \p parallel_reduce hands it one chunk
+ * per thread instead, since its results must not depend on who ran
+ * what.
+ *
+ * The worker threads are started by \p task_scheduler_init, i.e. when
+ * \p LibMeshInit is constructed (or on first use otherwise), and live
+ * until it is destroyed.  Between parallel regions idle workers spin
+ * on a generation counter for a short while before going to sleep, so
+ * back-to-back short regions are handed off without a system call.
+ * The calling thread always participates as thread 0.
+ *
+ * The pool runs one region at a time, for the thread which \p
+ * acquire()d it.  A region started while another is running, either
+ * by a body which itself calls \p parallel_for or by a second user
+ * thread, runs serially on the thread which started it.
+ */
+class TaskPool
 {
 public:
-  Range * range;
-  Body * body;
-};
+  /**
+   * Signature of the type-erased task run for each chunk:
+   * \p context is the user data passed to \p run(), \p thread_id is
+   * the index (in [0, n_participants)) of the executing thread.
+   */
+  typedef void (*task_function)(void * context,
+                                unsigned int thread_id,
+                                std::size_t chunk);
+
+  /**
+   * \returns The process-wide pool.
+   */
+  static TaskPool & get ();
+
+  /**
+   * Executes \p f(context, thread_id, chunk) for every chunk in
+   * [0, n_chunks) using \p n_participants threads (including the
+   * calling thread), and returns once all chunks are done.  Only the
+   * thread which acquired the pool may call this.
+   */
+  void run (task_function f,
+            void * context,
+            std::size_t n_chunks,
+            unsigned int n_participants);
+
+  /**
+   * Reserves the pool for the calling thread.  \returns \p false if
+   * another region is running, or if the calling thread is itself a
+   * worker or already owns the pool.
+   */
+  bool acquire ();
+
+  /**
+   * Frees the pool for the next region.
+   */
+  void release ();
+
+  /**
+   * Makes sure at least \p n worker threads exist.
+   */
+  void start (unsigned int n);
+
+  /**
+   * Wakes up and joins all worker threads.  The pool will restart
+   * them if it is used again afterwards.
+   */
+  void stop ();
+
+  /**
+   * \returns The number of worker threads currently alive, not
+   * counting the calling thread.
+   */
+  unsigned int n_workers () const { return cast_int<unsigned int>(_workers.size()); }
+
+  /**
+   * If \p pin is true, binds the calling thread and every worker
+   * thread to its own core, taken in order from the cores this
+   * process may run on (and reused cyclically if there are more
+   * threads than cores), so threads keep their caches and their
+   * NUMA-local memory between parallel regions.  Running workers are
+   * restarted to apply the change.  Only supported on Linux.
+   */
+  void set_affinity (bool pin);
+
+  ~TaskPool ();
 
-template <typename Range, typename Body>
-void * run_body(void * args)
-{
-  RangeBody<Range, Body> * range_body = (RangeBody<Range, Body> *)args;
+private:
+  TaskPool ();
 
-  Body & body = *range_body->body;
-  Range & range = *range_body->range;
+  /**
+   * The [begin, end) block of chunk indices owned by one thread.
+   * Padded so that neighbouring blocks don't share a cache line.
+   */
+  struct ChunkBlock
+  {
+    spin_mutex mutex;
+    std::size_t begin;
+    std::size_t end;
+    char padding[64];
+  };
+
+  /**
+   * Consumes chunks, first from block \p thread_id and then by
+   * stealing from the other participants, until no work is left.
+   */
+  void work (unsigned int thread_id);
+
+  /**
+   * Pops the next chunk of block \p thread_id into \p chunk.
+   * \returns \p false if that block is empty.
+   */
+  bool pop (unsigned int thread_id, std::size_t & chunk);
+
+  /**
+   * Moves the back half of some other participant's block into block
+   * \p thread_id.  \returns \p false if there was nothing to steal.
+   */
+  bool steal (unsigned int thread_id);
+
+  static void * worker_main (void * args);
+
+  struct WorkerArgs
+  {
+    TaskPool * pool;
+    unsigned int thread_id;
+    uint64_t region;
+  };
+
+  std::vector<pthread_t> _workers;
+
+  // The cores threads are pinned to, by thread id modulo their
+  // number, or empty if threads aren't pinned
+  std::vector<int> _cpus;
+
+  // One block per thread, the calling thread included.  Held by
+  // pointer since the spin mutexes must not be copied.
+  std::vector<ChunkBlock *> _blocks;
+
+  // The currently published parallel region
+  task_function _task;
+  void * _context;
+  unsigned int _n_participants;
+
+  // Handoff between the calling thread and the workers.  Publishing
+  // a region bumps _region; workers which have given up spinning on
+  // it sleep on _start_cond, and only then does the caller need to
+  // take _mutex.
+  std::atomic<uint64_t> _region;
+  std::atomic<unsigned int> _n_busy;
+  std::atomic<unsigned int> _n_sleeping;
+  std::atomic<bool> _shutdown;
+
+  // Whether some thread has acquired the pool
+  std::atomic<bool> _busy;
+
+  pthread_mutex_t _mutex;
+  pthread_cond_t _start_cond;
+};
 
-  body(range);
 
-  return libmesh_nullptr;
-}
 
 /**
- * Scheduler to manage threads.
+ * Scheduler to manage threads.  Creating one starts the worker threads
+ * of the \p TaskPool, destroying it (or calling \p terminate()) joins
+ * them.  \p LibMeshInit owns one for the lifetime of the library.
  */
 class task_scheduler_init
 {
 public:
   static const int automatic = -1;
-  explicit task_scheduler_init (int = automatic) {}
-  void initialize (int = automatic) {}
-  void terminate () {}
+  explicit task_scheduler_init (int n_threads = automatic) { this->initialize(n_threads); }
+  ~task_scheduler_init () { this->terminate(); }
+  void initialize (int n_threads = automatic);
+  void terminate ();
 };
 
-//-------------------------------------------------------------------
+
+
 /**
- * Dummy "splitting object" used to distinguish splitting constructors
- * from copy constructors.
+ * Acquires the \p TaskPool for one parallel region, and sets \p
+ * in_threads, until it goes out of scope.  If the pool is already
+ * in use, \p owned() is false and the caller has to run its range
+ * serially instead.
  */
-class split {};
+class RegionClaim
+{
+public:
+  RegionClaim () :
+    _owned(TaskPool::get().acquire())
+  {
+    if (_owned)
+      {
+        libmesh_assert(!in_threads);
+        in_threads = true;
+      }
+  }
 
+  ~RegionClaim ()
+  {
+    if (_owned)
+      {
+        in_threads = false;
+        TaskPool::get().release();
+      }
+  }
+
+  bool owned () const { return _owned; }
+
+private:
+  const bool _owned;
+};
 
 
 
-//-------------------------------------------------------------------
 /**
- * Execute the provided function object in parallel on the specified
- * range.
+ * Picks the chunk size used to split \p range among \p n_participants
+ * threads: never more than the range's grain size, and small enough
+ * that each thread gets several chunks to balance with.
  */
-template <typename Range, typename Body>
+template <typename Range>
 inline
-void parallel_for (const Range & range, const Body & body)
+std::size_t chunk_size (const Range & range, unsigned int n_participants)
 {
-  Threads::BoolAcquire b(Threads::in_threads);
+  const std::size_t size = range.size();
+  const std::size_t grainsize = std::max(static_cast<std::size_t>(range.grainsize()),
+                                         static_cast<std::size_t>(1));
+  const std::size_t balanced = size / (4*n_participants);
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
-  const bool logging_was_enabled = libMesh::perflog.logging_enabled();
+  return std::max(std::min(grainsize, balanced), static_cast<std::size_t>(1));
+}
 
-  if (libMesh::n_threads() > 1)
-    libMesh::perflog.disable_logging();
-#endif
 
-  unsigned int n_threads = num_pthreads(range);
 
-  std::vector<Range *> ranges(n_threads);
-  std::vector<RangeBody<const Range, const Body> > range_bodies(n_threads);
-  std::vector<pthread_t> threads(n_threads);
+/**
+ * Type-erased \p parallel_for work item: runs \p body on one chunk of
+ * \p range.
+ */
+template <typename Range, typename Body>
+struct ForTask
+{
+  const Range * range;
+  const Body * body;
+  std::size_t chunk_size;
 
-  // Create the ranges for each thread
-  unsigned int range_size = range.size() / n_threads;
+  static void run (void * context, unsigned int, std::size_t chunk)
+  {
+    const ForTask & task = *static_cast<ForTask *>(context);
+    const std::size_t first = chunk * task.chunk_size;
+    const std::size_t last  = std::min(first + task.chunk_size,
+                                       static_cast<std::size_t>(task.range->size()));
 
-  typename Range::const_iterator current_beginning = range.begin();
+    Range subrange(*task.range,
+                   task.range->begin() + first,
+                   task.range->begin() + last);
 
-  for (unsigned int i=0; i<n_threads; i++)
-    {
-      unsigned int this_range_size = range_size;
+    (*task.body)(subrange);
+  }
+};
 
-      if (i+1 == n_threads)
-        this_range_size += range.size() % n_threads; // Give the last one the remaining work to do
 
-      ranges[i] = new Range(range, current_beginning, current_beginning + this_range_size);
 
-      current_beginning = current_beginning + this_range_size;
-    }
+/**
+ * Type-erased \p parallel_reduce work item: runs body number \p block
+ * on the \p block-th of \p n_blocks contiguous pieces of \p range.
+ *
+ * Which body sees which elements, and so the order in which
+ * floating-point partial results are combined, depends only on the
+ * number of blocks and not on which thread happens to run them.
+ */
+template <typename Range, typename Body>
+struct ReduceTask
+{
+  const Range * range;
+  Body ** bodies;
+  std::size_t n_blocks;
+
+  static void run (void * context, unsigned int, std::size_t block)
+  {
+    const ReduceTask & task = *static_cast<ReduceTask *>(context);
+    const std::size_t size = task.range->size();
+    const std::size_t first = block * size / task.n_blocks;
+    const std::size_t last  = (block + 1) * size / task.n_blocks;
 
-  // Create the RangeBody arguments
-  for (unsigned int i=0; i<n_threads; i++)
+    Range subrange(*task.range,
+                   task.range->begin() + first,
+                   task.range->begin() + last);
+
+    (*task.bodies[block])(subrange);
+  }
+};
+
+
+
+//-------------------------------------------------------------------
+/**
+ * Execute the provided function object in parallel on the specified
+ * range.
+ */
+template <typename Range, typename Body>
+inline
+void parallel_for (const Range & range, const Body & body)
+{
+  // A body which calls this itself, or another user thread which
+  // started a region first, already has the pool
+  RegionClaim claim;
+  if (!claim.owned())
     {
-      range_bodies[i].range = ranges[i];
-      range_bodies[i].body = &body;
+      body(range);
+      return;
     }
 
-  // Create the threads.  It may seem redundant to wrap a pragma in
-  // #ifdefs... but GCC warns about an "unknown pragma" if it
-  // encounters this line of code when -fopenmp is not passed to the
-  // compiler.
-#ifdef LIBMESH_HAVE_OPENMP
-#pragma omp parallel for schedule (static)
-#endif
-  for (unsigned int i=0; i<n_threads; i++)
-    {
-#if !LIBMESH_HAVE_OPENMP
-      pthread_create(&threads[i], libmesh_nullptr, &run_body<Range, Body>, (void *)&range_bodies[i]);
-#else
-      run_body<Range, Body>((void *)&range_bodies[i]);
+#if defined(LIBMESH_ENABLE_PERFORMANCE_LOGGING) && !defined(LIBMESH_TLS)
+  const bool logging_was_enabled = libMesh::perflog.logging_enabled();
+
+  if (libMesh::n_threads() > 1)
+    libMesh::perflog.disable_logging();
 #endif
-    }
 
-#if !LIBMESH_HAVE_OPENMP
-  // Wait for them to finish
+  const unsigned int n_threads = num_pthreads(range);
+
+  ForTask<Range, Body> task;
+  task.range = &range;
+  task.body = &body;
+  task.chunk_size = chunk_size(range, n_threads);
 
+  const std::size_t n_chunks = range.empty() ? 0 :
+    (range.size() + task.chunk_size - 1) / task.chunk_size;
+
+  // It may seem redundant to wrap a pragma in #ifdefs... but GCC
+  // warns about an "unknown pragma" if it encounters this line of
+  // code when -fopenmp is not passed to the compiler.
+#ifdef LIBMESH_HAVE_OPENMP
   // The use of 'int' instead of unsigned for the iteration variable
   // is deliberate here.  This is an OpenMP loop, and some older
   // compilers warn when you don't use int for the loop index.  The
   // reason has to do with signed vs. unsigned integer overflow
   // behavior and optimization.
   // http://blog.llvm.org/2011/05/what-every-c-programmer-should-know.html
-  for (int i=0; i<static_cast<int>(n_threads); i++)
-    pthread_join(threads[i], libmesh_nullptr);
+#pragma omp parallel for schedule (dynamic) num_threads (n_threads)
+  for (int c=0; c<static_cast<int>(n_chunks); c++)
+    ForTask<Range, Body>::run(&task, 0, c);
+#else
+  if (n_threads == 1)
+    for (std::size_t c=0; c<n_chunks; c++)
+      ForTask<Range, Body>::run(&task, 0, c);
+  else
+    TaskPool::get().run(&ForTask<Range, Body>::run, &task,
+                        n_chunks, n_threads);
 #endif
 
-  // Clean up
-  for (unsigned int i=0; i<n_threads; i++)
-    delete ranges[i];
-
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
+#if defined(LIBMESH_ENABLE_PERFORMANCE_LOGGING) && !defined(LIBMESH_TLS)
   if (libMesh::n_threads() > 1 && logging_was_enabled)
     libMesh::perflog.enable_logging();
 #endif
@@ -366,78 +616,50 @@ template <typename Range, typename Body>
 inline
 void parallel_reduce (const Range & range, Body & body)
 {
-  Threads::BoolAcquire b(Threads::in_threads);
+  // A body which calls this itself, or another user thread which
+  // started a region first, already has the pool
+  RegionClaim claim;
+  if (!claim.owned())
+    {
+      body(range);
+      return;
+    }
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
+#if defined(LIBMESH_ENABLE_PERFORMANCE_LOGGING) && !defined(LIBMESH_TLS)
   const bool logging_was_enabled = libMesh::perflog.logging_enabled();
 
   if (libMesh::n_threads() > 1)
     libMesh::perflog.disable_logging();
 #endif
 
-  unsigned int n_threads = num_pthreads(range);
-
-  std::vector<Range *> ranges(n_threads);
-  std::vector<Body *> bodies(n_threads);
-  std::vector<RangeBody<Range, Body> > range_bodies(n_threads);
+  const unsigned int n_threads = num_pthreads(range);
 
   // Create copies of the body for each thread
+  std::vector<Body *> bodies(n_threads);
   bodies[0] = &body; // Use the original body for the first one
   for (unsigned int i=1; i<n_threads; i++)
     bodies[i] = new Body(body, Threads::split());
 
-  // Create the ranges for each thread
-  unsigned int range_size = range.size() / n_threads;
-
-  typename Range::const_iterator current_beginning = range.begin();
-
-  for (unsigned int i=0; i<n_threads; i++)
-    {
-      unsigned int this_range_size = range_size;
-
-      if (i+1 == n_threads)
-        this_range_size += range.size() % n_threads; // Give the last one the remaining work to do
-
-      ranges[i] = new Range(range, current_beginning, current_beginning + this_range_size);
-
-      current_beginning = current_beginning + this_range_size;
-    }
-
-  // Create the RangeBody arguments
-  for (unsigned int i=0; i<n_threads; i++)
-    {
-      range_bodies[i].range = ranges[i];
-      range_bodies[i].body = bodies[i];
-    }
-
-  // Create the threads
-  std::vector<pthread_t> threads(n_threads);
+  // Each body reduces one contiguous block of the range, so results
+  // are reproducible from run to run
+  ReduceTask<Range, Body> task;
+  task.range = &range;
+  task.bodies = &bodies[0];
+  task.n_blocks = n_threads;
 
   // It may seem redundant to wrap a pragma in #ifdefs... but GCC
   // warns about an "unknown pragma" if it encounters this line of
   // code when -fopenmp is not passed to the compiler.
 #ifdef LIBMESH_HAVE_OPENMP
-#pragma omp parallel for schedule (static)
-#endif
-  // The use of 'int' instead of unsigned for the iteration variable
-  // is deliberate here.  This is an OpenMP loop, and some older
-  // compilers warn when you don't use int for the loop index.  The
-  // reason has to do with signed vs. unsigned integer overflow
-  // behavior and optimization.
-  // http://blog.llvm.org/2011/05/what-every-c-programmer-should-know.html
+#pragma omp parallel for schedule (static) num_threads (n_threads)
   for (int i=0; i<static_cast<int>(n_threads); i++)
-    {
-#if !LIBMESH_HAVE_OPENMP
-      pthread_create(&threads[i], libmesh_nullptr, &run_body<Range, Body>, (void *)&range_bodies[i]);
+    ReduceTask<Range, Body>::run(&task, 0, i);
 #else
-      run_body<Range, Body>((void *)&range_bodies[i]);
-#endif
-    }
-
-#if !LIBMESH_HAVE_OPENMP
-  // Wait for them to finish
-  for (unsigned int i=0; i<n_threads; i++)
-    pthread_join(threads[i], libmesh_nullptr);
+  if (n_threads == 1)
+    ReduceTask<Range, Body>::run(&task, 0, 0);
+  else
+    TaskPool::get().run(&ReduceTask<Range, Body>::run, &task,
+                        n_threads, n_threads);
 #endif
 
   // Join them all down to the original Body
@@ -447,10 +669,8 @@ void parallel_reduce (const Range & range, Body & body)
   // Clean up
   for (unsigned int i=1; i<n_threads; i++)
     delete bodies[i];
-  for (unsigned int i=0; i<n_threads; i++)
-    delete ranges[i];
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
+#if defined(LIBMESH_ENABLE_PERFORMANCE_LOGGING) && !defined(LIBMESH_TLS)
   if (libMesh::n_threads() > 1 && logging_was_enabled)
     libMesh::perflog.enable_logging();
 #endif
@@ -470,7 +690,8 @@ void parallel_reduce (const Range & range, Body & body, const Partitioner &)
 
 /**
  * Defines atomic operations which can only be executed on a
- * single thread at a time.
+ * single thread at a time.  These are lock-free wherever std::atomic
+ * is.
  */
 template <typename T>
 class atomic
@@ -481,64 +702,49 @@ public:
 
   T operator=( T value )
   {
-    spin_mutex::scoped_lock lock(smutex);
     val = value;
-    return val;
+    return value;
   }
 
   atomic<T> & operator=( const atomic<T> & value )
   {
-    spin_mutex::scoped_lock lock(smutex);
-    val = value;
+    val = value.val.load();
     return *this;
   }
 
 
   T operator+=(T value)
   {
-    spin_mutex::scoped_lock lock(smutex);
-    val += value;
-    return val;
+    return val += value;
   }
 
   T operator-=(T value)
   {
-    spin_mutex::scoped_lock lock(smutex);
-    val -= value;
-    return val;
+    return val -= value;
   }
 
   T operator++()
   {
-    spin_mutex::scoped_lock lock(smutex);
-    val++;
-    return val;
+    return ++val;
   }
 
   T operator++(int)
   {
-    spin_mutex::scoped_lock lock(smutex);
-    val++;
-    return val;
+    return val++;
   }
 
   T operator--()
   {
-    spin_mutex::scoped_lock lock(smutex);
-    val--;
-    return val;
+    return --val;
   }
 
   T operator--(int)
   {
-    spin_mutex::scoped_lock lock(smutex);
-    val--;
-    return val;
+    return val--;
   }
 
 private:
-  T val;
-  spin_mutex smutex;
+  std::atomic<T> val;
 };
 
 } // namespace Threads
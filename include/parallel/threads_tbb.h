@@ -88,7 +88,7 @@ void parallel_for (const Range & range, const Body & body)
 {
   BoolAcquire b(in_threads);
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
+#if defined(LIBMESH_ENABLE_PERFORMANCE_LOGGING) && !defined(LIBMESH_TLS)
   const bool logging_was_enabled = libMesh::perflog.logging_enabled();
 
   if (libMesh::n_threads() > 1)
@@ -101,7 +101,7 @@ void parallel_for (const Range & range, const Body & body)
   else
     body(range);
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
+#if defined(LIBMESH_ENABLE_PERFORMANCE_LOGGING) && !defined(LIBMESH_TLS)
   if (libMesh::n_threads() > 1 && logging_was_enabled)
     libMesh::perflog.enable_logging();
 #endif
@@ -119,7 +119,7 @@ void parallel_for (const Range & range, const Body & body, const Partitioner & p
 {
   BoolAcquire b(in_threads);
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
+#if defined(LIBMESH_ENABLE_PERFORMANCE_LOGGING) && !defined(LIBMESH_TLS)
   const bool logging_was_enabled = libMesh::perflog.logging_enabled();
 
   if (libMesh::n_threads() > 1)
@@ -132,7 +132,7 @@ void parallel_for (const Range & range, const Body & body, const Partitioner & p
   else
     body(range);
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
+#if defined(LIBMESH_ENABLE_PERFORMANCE_LOGGING) && !defined(LIBMESH_TLS)
   if (libMesh::n_threads() > 1 && logging_was_enabled)
     libMesh::perflog.enable_logging();
 #endif
@@ -150,7 +150,7 @@ void parallel_reduce (const Range & range, Body & body)
 {
   BoolAcquire b(in_threads);
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
+#if defined(LIBMESH_ENABLE_PERFORMANCE_LOGGING) && !defined(LIBMESH_TLS)
   const bool logging_was_enabled = libMesh::perflog.logging_enabled();
 
   if (libMesh::n_threads() > 1)
@@ -163,7 +163,7 @@ void parallel_reduce (const Range & range, Body & body)
   else
     body(range);
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
+#if defined(LIBMESH_ENABLE_PERFORMANCE_LOGGING) && !defined(LIBMESH_TLS)
   if (libMesh::n_threads() > 1 && logging_was_enabled)
     libMesh::perflog.enable_logging();
 #endif
@@ -181,7 +181,7 @@ void parallel_reduce (const Range & range, Body & body, const Partitioner & part
 {
   BoolAcquire b(in_threads);
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
+#if defined(LIBMESH_ENABLE_PERFORMANCE_LOGGING) && !defined(LIBMESH_TLS)
   const bool logging_was_enabled = libMesh::perflog.logging_enabled();
 
   if (libMesh::n_threads() > 1)
@@ -194,7 +194,7 @@ void parallel_reduce (const Range & range, Body & body, const Partitioner & part
   else
     body(range);
 
-#ifdef LIBMESH_ENABLE_PERFORMANCE_LOGGING
+#if defined(LIBMESH_ENABLE_PERFORMANCE_LOGGING) && !defined(LIBMESH_TLS)
   if (libMesh::n_threads() > 1 && logging_was_enabled)
     libMesh::perflog.enable_logging();
 #endif
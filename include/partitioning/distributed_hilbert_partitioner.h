@@ -0,0 +1,85 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_DISTRIBUTED_HILBERT_PARTITIONER_H
+#define LIBMESH_DISTRIBUTED_HILBERT_PARTITIONER_H
+
+// Local Includes
+#include "libmesh/partitioner.h"
+
+namespace libMesh
+{
+
+/**
+ * The \p DistributedHilbertPartitioner cuts the Hilbert curve through
+ * the element centroids into pieces of equal weight, without ever
+ * serializing the mesh.
+ *
+ * The elements are ordered along the curve by the parallel sort of
+ * MeshCommunication::find_global_indices().  Each processor then
+ * sums the weights of one contiguous block of curve positions, and
+ * the block sums are combined into a prefix sum which places every
+ * element in its part.  No processor needs more than its own
+ * elements and one block of weights, so the work is O(n/p log p).
+ *
+ * Weights attached with attach_weights() are indexed by element id;
+ * elements without one weigh Partitioner::estimated_cost().  This partitioner needs libHilbert
+ * to run on more than one processor.
+ */
+class DistributedHilbertPartitioner : public Partitioner
+{
+public:
+
+  /**
+   * Constructor.
+   */
+  DistributedHilbertPartitioner () {}
+
+  /**
+   * \returns A copy of this partitioner wrapped in a smart pointer.
+   */
+  virtual UniquePtr<Partitioner> clone () const libmesh_override
+  {
+    return UniquePtr<Partitioner>(new DistributedHilbertPartitioner());
+  }
+
+  virtual void attach_weights(ErrorVector * weights) libmesh_override { _weights = weights; }
+
+  /**
+   * Called by the SubdomainPartitioner to partition elements in the
+   * range (it, end).  Every processor sets the new processor ids of
+   * the elements of the range it has.
+   */
+  virtual void partition_range(MeshBase & mesh,
+                               MeshBase::element_iterator it,
+                               MeshBase::element_iterator end,
+                               const unsigned int n) libmesh_override;
+
+protected:
+
+  /**
+   * Partition the \p MeshBase into \p n subdomains.
+   */
+  virtual void _do_partition (MeshBase & mesh,
+                              const unsigned int n) libmesh_override;
+};
+
+} // namespace libMesh
+
+#endif  // LIBMESH_DISTRIBUTED_HILBERT_PARTITIONER_H
@@ -62,9 +62,41 @@ public:
    */
   virtual UniquePtr<Partitioner> clone () const libmesh_override
   {
-    return UniquePtr<Partitioner>(new ParmetisPartitioner());
+    ParmetisPartitioner * copy = new ParmetisPartitioner();
+    copy->_incremental = _incremental;
+    copy->_itr = _itr;
+    return UniquePtr<Partitioner>(copy);
   }
 
+  /**
+   * Weights attached here are indexed by element id and truncated to
+   * integers, as ParMETIS needs; without them elements are weighed by
+   * Partitioner::estimated_cost().
+   */
+  virtual void attach_weights(ErrorVector * weights) libmesh_override { _weights = weights; }
+
+  /**
+   * Whether repartitioning should start from the current partitioning,
+   * so that after adaptive refinement ParMETIS only moves as many
+   * elements as it needs to restore the balance.  The amount of
+   * data moved is then estimated by the element weights too.
+   * Defaults to false, in which case it starts from a space-filling
+   * curve partitioning.
+   */
+  bool   incremental() const { return _incremental; }
+  bool & incremental()       { return _incremental; }
+
+  /**
+   * The ratio of inter-processor communication time to data
+   * redistribution time which ParMETIS assumes when repartitioning.
+   * Small values (around 1 to 10) favour moving few elements, large
+   * ones favour a small edge cut.  Defaults to 1.e6, which all but
+   * ignores the cost of migration; something around 1000 is a better
+   * choice for incremental() repartitioning.
+   */
+  Real   itr() const { return _itr; }
+  Real & itr()       { return _itr; }
+
 
 protected:
 
@@ -85,6 +117,10 @@ protected:
 
 private:
 
+  bool _incremental;
+
+  Real _itr;
+
   // These methods and data only need to be available if the
   // ParMETIS library is available.
 #ifdef LIBMESH_HAVE_PARMETIS
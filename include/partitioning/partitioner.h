@@ -186,6 +186,13 @@ protected:
   void single_partition_range(MeshBase::element_iterator it,
                               MeshBase::element_iterator end);
 
+  /**
+   * \returns An estimate of the cost of assembling on \p elem, for
+   * use as its weight when no weights are attached: its number of
+   * nodes, times (p+1)^dim for an element of p refinement level p.
+   */
+  static dof_id_type estimated_cost (const Elem & elem);
+
   /**
    * This is the actual partitioning method which must be overridden
    * in derived classes.  It is called via the public partition()
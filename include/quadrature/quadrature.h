@@ -166,6 +166,10 @@ public:
   /**
    * Initializes the data structures for a quadrature rule for an
    * element of type \p type.
+   *
+   * The built in rules are computed once per combination of rule,
+   * dimension, element type and order, then copied from a cache
+   * shared by all \p QBase objects.
    */
   virtual void init (const ElemType type=INVALID_ELEM,
                      unsigned int p_level=0);
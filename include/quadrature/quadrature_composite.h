@@ -29,6 +29,11 @@
 #include "libmesh/elem_cutter.h"
 #include "libmesh/fe_base.h"
 #include "libmesh/auto_ptr.h"
+#include "libmesh/id_types.h"
+
+// C++ includes
+#include <vector>
+#include LIBMESH_INCLUDE_UNORDERED_MAP
 
 namespace libMesh
 {
@@ -77,11 +82,21 @@ public:
   /**
    * Overrides the base class init() function, and uses the ElemCutter to
    * subdivide the element into "inside" and "outside" subelements.
+   *
+   * The composite rule of each cut element is cached, and reused as
+   * long as the element is initialized with the same p level and
+   * distance function values, so a static interface is only cut once.
    */
   virtual void init (const Elem & elem,
                      const std::vector<Real> & vertex_distance_func,
                      unsigned int p_level=0) libmesh_override;
 
+  /**
+   * Discards all cached composite rules.  Should be called if element
+   * ids are reused, e.g. after the mesh is refined or renumbered.
+   */
+  void clear_cut_rule_cache () { _cut_rule_cache.clear(); }
+
 private:
 
   /**
@@ -104,6 +119,25 @@ private:
    * Lagrange FE to use for subcell mapping.
    */
   UniquePtr<FEBase> _lagrange_fe;
+
+  /**
+   * A composite rule, with the inputs it was built for.
+   */
+  struct CutRule
+  {
+    CutRule () : elem_type(INVALID_ELEM), p_level(0) {}
+
+    ElemType elem_type;
+    unsigned int p_level;
+    std::vector<Real> vertex_distance_func;
+    std::vector<Point> points;
+    std::vector<Real> weights;
+  };
+
+  /**
+   * Composite rules of cut elements, by element id.
+   */
+  LIBMESH_BEST_UNORDERED_MAP<dof_id_type, CutRule> _cut_rule_cache;
 };
 
 } // namespace libMesh
@@ -80,6 +80,17 @@ public:
                                          SparseMatrix<Number> & input_matrix,
                                          NumericVector<Number> & input_rhs);
 
+  /**
+   * Solves \p input_matrix * \p solutions[i] = \p rhs[i] for every
+   * \p i, setting up the preconditioner or factorization of \p
+   * input_matrix only once.  The solutions start from zero.  Unlike
+   * solve_for_matrix_and_rhs() this leaves the system solution alone.
+   */
+  virtual void solve_for_matrix_and_multiple_rhs (LinearSolver<Number> & input_solver,
+                                                  SparseMatrix<Number> & input_matrix,
+                                                  const std::vector<NumericVector<Number> *> & solutions,
+                                                  const std::vector<NumericVector<Number> *> & rhs);
+
   /**
    * Set the RBEvaluation object.
    */
@@ -131,6 +131,17 @@ public:
    */
   void set_training_random_seed(unsigned int seed);
 
+  /**
+   * If \p quasi_random is true, non-deterministic training sets are
+   * not stored, but each sample is computed from its index when it is
+   * needed, as a point of a Halton sequence which is shifted by an
+   * amount that depends on the training random seed.  Each processor
+   * then only ever computes its own samples, and the memory used by
+   * the training set does not grow with its size.  Defaults to false.
+   * This must be called before the training set is generated.
+   */
+  void set_quasi_random_training_set(bool quasi_random);
+
   /**
    * In some cases we only want to allow discrete parameter values, instead
    * of parameters that may take any value in a specified interval.
@@ -255,6 +266,25 @@ private:
    */
   int training_parameters_random_seed;
 
+  /**
+   * Whether random training sets should be generated on demand from
+   * a quasi-random sequence; see set_quasi_random_training_set().
+   */
+  bool quasi_random_training_set;
+
+  /**
+   * The description of the current training set, if it is generated
+   * on demand: the number of samples, the parameter ranges and
+   * scalings, and the shift of the Halton sequence in each parameter.
+   * \p quasi_random_shifts is empty if the training set is stored
+   * in \p training_parameters instead.
+   */
+  numeric_index_type n_quasi_random_training_samples;
+  RBParameters quasi_random_min_parameters;
+  RBParameters quasi_random_max_parameters;
+  std::map<std::string, bool> quasi_random_log_param_scale;
+  std::vector<Real> quasi_random_shifts;
+
 };
 
 } // namespace libMesh
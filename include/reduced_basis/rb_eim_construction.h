@@ -302,6 +302,63 @@ protected:
 
 private:
 
+  /**
+   * The quadrature data of an active local element which
+   * truth_solve() and enrich_RB_space() need for every parameter
+   * and greedy step.
+   */
+  struct ElemQuadratureData
+  {
+    const Elem * elem;
+
+    /**
+     * The quadrature points, weights, shape functions (indexed by qp
+     * then dof) and dof indices of the implicit system.
+     */
+    std::vector<Point> xyz;
+    std::vector<Real> JxW;
+    std::vector<std::vector<Real> > phi;
+    std::vector<dof_id_type> dof_indices;
+
+    /**
+     * The quadrature points and shape functions of each variable of
+     * the explicit system, and where the dof indices of each
+     * variable start in \p _explicit_dof_indices, followed by where
+     * those of the last variable end.
+     */
+    std::vector<std::vector<Point> > explicit_xyz;
+    std::vector<std::vector<std::vector<Real> > > explicit_phi;
+    std::vector<std::size_t> explicit_dofs_begin;
+  };
+
+  /**
+   * Computes \p _elem_quadrature_data, unless that was done already.
+   */
+  void cache_quadrature_data();
+
+  /**
+   * Finds the quadrature point of the largest absolute value of an
+   * explicit system solution in a range of \p _elem_quadrature_data,
+   * for Threads::parallel_reduce().
+   */
+  class FindLargestValue;
+
+  /**
+   * The quadrature data of all the active local elements, computed
+   * once, as FE reinitialization would otherwise dominate the
+   * training.
+   */
+  std::vector<ElemQuadratureData> _elem_quadrature_data;
+
+  /**
+   * The explicit system dof indices of every variable on every
+   * element in \p _elem_quadrature_data, one after another, so that
+   * the values of a solution on them can be fetched all at once.
+   */
+  std::vector<dof_id_type> _explicit_dof_indices;
+
+  bool _quadrature_data_cached;
+
   /**
    * A mesh function to interpolate on the mesh.
    */
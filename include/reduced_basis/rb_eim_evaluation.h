@@ -117,6 +117,16 @@ public:
    */
   virtual Real rb_solve(unsigned int N) libmesh_override;
 
+  /**
+   * Solves at each of \p parameters in turn, since the error bounds
+   * of the EIM solves cannot be batched.
+   */
+  virtual void rb_solve_batch(unsigned int N,
+                              const std::vector<RBParameters> & parameters,
+                              std::vector<Number> & outputs,
+                              std::vector<Real> & output_error_bounds,
+                              std::vector<Real> & error_bounds) libmesh_override;
+
   /**
    * Calculate the EIM approximation for the given
    * right-hand side vector \p EIM_rhs. Store the
@@ -192,6 +202,16 @@ public:
    */
   std::vector<Elem *> interpolation_points_elem;
 
+protected:
+
+  /**
+   * Adds the interpolation data, including copies of the elements
+   * in \p interpolation_points_elem, to a raw offline data file.
+   */
+  virtual void write_raw_data (std::ostream & out) libmesh_override;
+  virtual void read_raw_data (RawDataReader & in,
+                              bool read_error_bound_data) libmesh_override;
+
 private:
 
   /**
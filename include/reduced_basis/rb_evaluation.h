@@ -30,6 +30,9 @@
 #include "libmesh/parallel_object.h"
 
 // C++ includes
+#include <algorithm>
+#include <cstring>
+#include <iosfwd>
 
 namespace libMesh
 {
@@ -109,6 +112,28 @@ public:
    */
   virtual Real rb_solve(unsigned int N);
 
+  /**
+   * Solves the RB system with \p N basis functions at each of \p
+   * parameters, for answering many online queries at once.  Output
+   * \p n at sample \p i is stored in \p outputs[i*n_outputs+n], and
+   * its error bound at the same place in \p output_error_bounds; the
+   * error bound of the solution at sample \p i is stored in \p
+   * error_bounds[i].  Error bounds are -1 unless \p
+   * evaluate_RB_error_bound is set.  The current parameters are
+   * restored afterwards.
+   *
+   * The residual dual norms of all samples are computed together by
+   * \p compute_residual_dual_norms(), so subclasses whose residuals
+   * are not of that form, i.e. which override \p
+   * compute_residual_dual_norm(), must override this as well, e.g.
+   * by calling \p rb_solve_each().
+   */
+  virtual void rb_solve_batch(unsigned int N,
+                              const std::vector<RBParameters> & parameters,
+                              std::vector<Number> & outputs,
+                              std::vector<Real> & output_error_bounds,
+                              std::vector<Real> & error_bounds);
+
   /**
    * \returns A scaling factor that we can use to provide a consistent
    * scaling of the RB error bound across different parameter values.
@@ -121,6 +146,18 @@ public:
    */
   virtual Real compute_residual_dual_norm(const unsigned int N);
 
+  /**
+   * Computes the dual norms of the residuals of the RB solutions with
+   * \p N basis functions in the columns of \p RB_solutions, one at
+   * each of \p parameters.  The stored representor inner products
+   * are gathered into one Hermitian matrix, so that all the norms
+   * follow from a single matrix-matrix product.
+   */
+  void compute_residual_dual_norms(unsigned int N,
+                                   const std::vector<RBParameters> & parameters,
+                                   const DenseMatrix<Number> & RB_solutions,
+                                   std::vector<Real> & dual_norms);
+
   /**
    * Specifies the residual scaling on the denominator to
    * be used in the a posteriori error bound. Override
@@ -176,6 +213,25 @@ public:
                                                    bool read_error_bound_data=true,
                                                    const bool read_binary_data=true);
 
+  /**
+   * Write out the Offline reduced basis data, i.e. everything
+   * legacy_write_offline_data_to_files() writes except for the
+   * greedily selected parameters, to a single binary file in the
+   * native byte order and Number type, in which every array starts
+   * on an 8 byte boundary.  Only processor 0 writes.  Subclasses
+   * with more Offline data add it in \p write_raw_data().
+   */
+  virtual void write_offline_data_to_raw_file(const std::string & file_name = "offline_data.raw");
+
+  /**
+   * Read in Offline reduced basis data written by
+   * write_offline_data_to_raw_file().  The file is memory-mapped,
+   * so processors reading it share its pages, and the arrays are
+   * copied straight into place without any parsing.
+   */
+  virtual void read_offline_data_from_raw_file(const std::string & file_name = "offline_data.raw",
+                                               bool read_error_bound_data=true);
+
   /**
    * Write out all the basis functions to file.
    * \p sys is used for file IO
@@ -332,11 +388,105 @@ public:
 
 protected:
 
+  /**
+   * Implements \p rb_solve_batch() by calling \p rb_solve() at each
+   * of \p parameters in turn, for subclasses which cannot batch
+   * their error bounds.
+   */
+  void rb_solve_each(unsigned int N,
+                     const std::vector<RBParameters> & parameters,
+                     std::vector<Number> & outputs,
+                     std::vector<Real> & output_error_bounds,
+                     std::vector<Real> & error_bounds);
+
   /**
    * Helper function that checks if \p file_name exists.
    */
   void assert_file_exists(const std::string & file_name);
 
+  /**
+   * Hands out the arrays of a raw offline data file, in the order
+   * they were written, straight from the mapped file.
+   */
+  class RawDataReader
+  {
+  public:
+    RawDataReader (const std::string & file_name,
+                   const char * data, std::size_t size) :
+      _file_name(file_name), _pos(data), _end(data + size) {}
+
+    /**
+     * \returns The name of the file, for error messages.
+     */
+    const std::string & file_name () const { return _file_name; }
+
+    /**
+     * \returns The next \p n entries, in place, and moves on to the
+     * next 8 byte boundary.
+     */
+    template <typename T>
+    const T * take (std::size_t n)
+    {
+      const std::size_t n_bytes = n*sizeof(T);
+      if (std::size_t(_end - _pos) < n_bytes)
+        libmesh_error_msg("ERROR: truncated raw RB offline data file " << _file_name);
+
+      libmesh_assert_equal_to(reinterpret_cast<std::size_t>(_pos) % sizeof(T), 0);
+      const T * a = reinterpret_cast<const T *>(_pos);
+      _pos += std::min<std::size_t>((n_bytes + 7) / 8 * 8, _end - _pos);
+      return a;
+    }
+
+    /**
+     * Copies the next \p n entries into \p a, or just skips them if
+     * \p a is NULL.
+     */
+    template <typename T>
+    void copy (std::size_t n, T * a)
+    {
+      const T * data = this->take<T>(n);
+      if (a && n)
+        std::memcpy(a, data, n*sizeof(T));
+    }
+
+  private:
+    const std::string _file_name;
+    const char * _pos;
+    const char * _end;
+  };
+
+  /**
+   * Writes the \p n_bytes starting at \p begin to a raw offline data
+   * file, padded to a multiple of 8 bytes.
+   */
+  static void write_raw (std::ostream & out, const void * begin, std::size_t n_bytes);
+
+  /**
+   * Writes the first \p n entries of \p a to a raw offline data file.
+   */
+  template <typename T>
+  static void write_raw (std::ostream & out, const std::vector<T> & a, std::size_t n)
+  {
+    libmesh_assert_less_equal(n, a.size());
+    if (n)
+      write_raw(out, &a[0], n*sizeof(T));
+  }
+
+  /**
+   * Writes this object's part of a raw offline data file.
+   * Subclasses with more Offline data call this first and then
+   * append theirs, preferably starting with a tag of their own.
+   */
+  virtual void write_raw_data (std::ostream & out);
+
+  /**
+   * Reads what \p write_raw_data() wrote.  Data this object has no
+   * use for, such as the error bound data if not
+   * \p read_error_bound_data, still has to be skipped.
+   */
+  virtual void read_raw_data (RawDataReader & in,
+                              bool read_error_bound_data);
+
 private:
 
   /**
@@ -346,6 +496,23 @@ private:
    */
   RBThetaExpansion * rb_theta_expansion;
 
+  /**
+   * Scratch space for the RB system assembled in \p rb_solve(),
+   * kept so that repeated solves do not reallocate it.
+   */
+  DenseMatrix<Number> RB_system_matrix;
+  DenseVector<Number> RB_rhs;
+
+  /**
+   * Scratch space for \p rb_solve_batch() and \p
+   * compute_residual_dual_norms(), so that repeated batches of the
+   * same size do not reallocate it.
+   */
+  DenseMatrix<Number> RB_batch_solutions;
+  DenseMatrix<Number> RB_residual_gram;
+  DenseMatrix<Number> RB_residual_weights;
+  DenseMatrix<Number> RB_residual_products;
+
 };
 
 }
@@ -86,6 +86,20 @@ public:
    */
   virtual Real get_SCM_UB();
 
+  /**
+   * Evaluate the SCM lower and upper bounds for each of \p mus at
+   * once.  The LP constraints are set up once for all of them, each
+   * LP solve is warm started from the previous one, and the LPs are
+   * solved in parallel over threads, so GLPK must have been built
+   * thread safe (with thread local storage, the default) when
+   * running with more than one thread.  The bounds are those of
+   * get_SCM_LB() and get_SCM_UB(); subclasses which override those
+   * should override this too.
+   */
+  virtual void get_SCM_bounds(const std::vector<RBParameters> & mus,
+                              std::vector<Real> & LBs,
+                              std::vector<Real> & UBs);
+
   /**
    * Get stability constraints (i.e. the values of coercivity/
    * inf-sup/stability constants at the parameter values chosen
@@ -207,6 +221,13 @@ public:
 
 private:
 
+  /**
+   * Evaluate the theta functions of the operator at each element
+   * of C_J; these are the coefficients of the constraints in the
+   * SCM lower bound LP.
+   */
+  void compute_C_J_thetas(std::vector<std::vector<Real> > & C_J_thetas);
+
   /**
    * Vector in which to save a parameter set. Useful
    * in get_SCM_LB, for example.
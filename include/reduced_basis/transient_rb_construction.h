@@ -193,7 +193,10 @@ public:
   virtual void get_all_matrices(std::map<std::string, SparseMatrix<Number> *> & all_matrices) libmesh_override;
 
   /**
-   * Assemble the truth system in the transient linear case.
+   * Assemble the truth system in the transient linear case.  Within a
+   * truth_solve() the left hand side does not depend on the time
+   * level, so after the first time step only the right hand side is
+   * assembled.
    */
   virtual void truth_assembly() libmesh_override;
 
@@ -404,6 +407,13 @@ private:
    * Dense matrix to store the data that we use for the temporal POD.
    */
   std::vector< NumericVector<Number> * > temporal_data;
+
+  /**
+   * True while the truth matrix holds the time-invariant left hand
+   * side for the current parameters, so that truth_assembly() only
+   * has to assemble the right hand side.  Only set during truth_solve().
+   */
+  bool truth_matrix_assembled;
 };
 
 } // namespace libMesh
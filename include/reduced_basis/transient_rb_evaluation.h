@@ -90,6 +90,16 @@ public:
    */
   virtual Real rb_solve(unsigned int N) libmesh_override;
 
+  /**
+   * Solves at each of \p parameters in turn, since the error bounds
+   * of the time-dependent solves cannot be batched.
+   */
+  virtual void rb_solve_batch(unsigned int N,
+                              const std::vector<RBParameters> & parameters,
+                              std::vector<Number> & outputs,
+                              std::vector<Real> & output_error_bounds,
+                              std::vector<Real> & error_bounds) libmesh_override;
+
   /**
    * If a solve has already been performed, then we cached some data
    * and we can perform a new solve much more rapidly
@@ -246,6 +256,16 @@ public:
    * Check that the data has been cached in case of using rb_solve_again
    */
   bool _rb_solve_data_cached;
+
+protected:
+
+  /**
+   * Adds the temporal discretization, mass matrix and initial
+   * condition data to a raw offline data file.
+   */
+  virtual void write_raw_data (std::ostream & out) libmesh_override;
+  virtual void read_raw_data (RawDataReader & in,
+                              bool read_error_bound_data) libmesh_override;
 };
 
 }
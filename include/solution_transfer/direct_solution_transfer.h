@@ -23,6 +23,7 @@
 #include "libmesh/solution_transfer.h"
 
 #include <string>
+#include <vector>
 
 namespace libMesh
 {
@@ -50,6 +51,27 @@ public:
    * Transfer the values of a variable to another.
    */
   virtual void transfer(const Variable & from_var, const Variable & to_var) libmesh_override;
+
+  virtual void clear_cache () libmesh_override { _index_maps.clear(); }
+
+private:
+
+  /**
+   * The matching local source and target indices for one pair of
+   * variables, and the system sizes they were built for.
+   */
+  struct IndexMap
+  {
+    dof_id_type from_n_dofs;
+    dof_id_type to_n_dofs;
+    std::vector<numeric_index_type> from_indices;
+    std::vector<numeric_index_type> to_indices;
+  };
+
+  /**
+   * Cached index maps, if \p cache_mappings() is set.
+   */
+  std::map<transfer_key, IndexMap> _index_maps;
 };
 
 } // namespace libMesh
@@ -0,0 +1,159 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef L2_PROJECTION_SOLUTION_TRANSFER_H
+#define L2_PROJECTION_SOLUTION_TRANSFER_H
+
+#include "libmesh/solution_transfer.h"
+#include "libmesh/enum_order.h"
+#include "libmesh/point.h"
+
+// C++ includes
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward Declarations
+class Elem;
+class MeshBase;
+
+/**
+ * SolutionTransfer object which L2-projects a variable onto a variable
+ * on another, non-matching mesh.
+ *
+ * The right hand side of the projection is integrated exactly over the
+ * intersections of the "from" and "to" elements (a supermesh), rather
+ * than by sampling the "from" solution at the "to" quadrature points.
+ * Candidate element pairs come from a \p PointLocatorBVH over the
+ * "from" mesh; each pair is intersected by clipping the "to" element
+ * against the faces of the "from" element, and the resulting convex
+ * pieces are split into simplices and integrated with \p QGauss.  The
+ * projected field therefore has the same integral as the original
+ * wherever the "to" space contains the constants and the meshes cover
+ * the same domain.
+ *
+ * The projection's mass matrix is solved matrix-free with Jacobi
+ * preconditioned conjugate gradients, in parallel over the "to"
+ * mesh, which may be distributed.  The "from" mesh must be
+ * serialized; each processor gathers only the "from" solution values
+ * it needs.
+ *
+ * The elements must have straight edges and planar faces, and be
+ * convex; on other elements the intersections are approximate.  Only
+ * scalar-valued variables are supported.
+ *
+ * The intersections depend only on the two meshes, so they are
+ * computed once for all the variables of a multi-variable
+ * \p transfer(), and with \p cache_mappings() set they are kept for
+ * later transfers between the same meshes as well.
+ *
+ * \brief Conservative L2 projection between non-matching meshes.
+ */
+class L2ProjectionSolutionTransfer : public SolutionTransfer
+{
+public:
+  L2ProjectionSolutionTransfer (const Parallel::Communicator & comm_in
+                                LIBMESH_CAN_DEFAULT_TO_COMMWORLD);
+
+  virtual ~L2ProjectionSolutionTransfer();
+
+  /**
+   * Project the values of a variable onto another.
+   */
+  virtual void transfer(const Variable & from_var, const Variable & to_var) libmesh_override;
+
+  /**
+   * Project each of \p from_vars onto the matching entry of \p
+   * to_vars.  All of \p from_vars must live on one mesh, and all of
+   * \p to_vars on another, and the mesh intersections are computed
+   * only once for all of them.
+   */
+  void transfer(const std::vector<const Variable *> & from_vars,
+                const std::vector<const Variable *> & to_vars);
+
+  virtual void clear_cache () libmesh_override { _intersections.clear(); }
+
+  /**
+   * Sets the relative residual tolerance and the iteration limit of
+   * the mass matrix solves.
+   */
+  void set_solver_parameters (Real tolerance, unsigned int max_iterations)
+  { _tolerance = tolerance; _max_iterations = max_iterations; }
+
+private:
+
+  /**
+   * The quadrature points over the intersections of the active local
+   * "to" elements with the "from" elements.  Each piece is the
+   * intersection of one pair of elements; its points are kept in the
+   * reference coordinates of both, with physical weights.
+   */
+  struct Intersections
+  {
+    dof_id_type from_n_elem;
+    dof_id_type to_n_elem;
+    int order;
+    std::vector<const Elem *> to_elems;
+    std::vector<std::size_t> to_offsets;
+    std::vector<const Elem *> from_elems;
+    std::vector<std::size_t> qp_offsets;
+    std::vector<Point> from_points;
+    std::vector<Point> to_points;
+    std::vector<Real> weights;
+  };
+
+  /**
+   * Fills \p isect with the intersections of \p from_mesh and the
+   * local elements of \p to_mesh, with a quadrature rule of order \p
+   * order on each piece.
+   */
+  void build_intersections (const MeshBase & from_mesh,
+                            const MeshBase & to_mesh,
+                            Order order,
+                            Intersections & isect) const;
+
+  /**
+   * Projects \p from_var onto \p to_var using \p isect.
+   */
+  void project (const Variable & from_var,
+                const Variable & to_var,
+                const Intersections & isect) const;
+
+  /**
+   * The intersections for each (from, to) pair of meshes.
+   */
+  std::map<std::pair<const MeshBase *, const MeshBase *>, Intersections> _intersections;
+
+  /**
+   * The relative residual tolerance of the mass matrix solves.
+   */
+  Real _tolerance;
+
+  /**
+   * The most conjugate gradient iterations per mass matrix solve.
+   */
+  unsigned int _max_iterations;
+};
+
+} // namespace libMesh
+
+#endif // L2_PROJECTION_SOLUTION_TRANSFER_H
@@ -76,7 +76,8 @@ public:
   MeshfreeInterpolation (const libMesh::Parallel::Communicator & comm_in
                          LIBMESH_CAN_DEFAULT_TO_COMMWORLD) :
     ParallelObject(comm_in),
-    _parallelization_strategy (SYNC_SOURCES)
+    _parallelization_strategy (SYNC_SOURCES),
+    _n_local_src_vals (0)
   {}
 
   /**
@@ -143,6 +144,15 @@ public:
    */
   virtual void prepare_for_use ();
 
+  /**
+   * Replaces the source values after \p prepare_for_use(), keeping
+   * the source points and whatever was built from them.  \p vals
+   * holds new values for the points added on this processor, in the
+   * order they were added.  With \p SYNC_SOURCES this must be called
+   * on all processors at once.
+   */
+  virtual void update_field_data (const std::vector<Number> & vals);
+
   /**
    * Interpolate source data at target points.
    * Pure virtual, must be overriden in derived classes.
@@ -167,6 +177,12 @@ protected:
   std::vector<std::string> _names;
   std::vector<Point>       _src_pts;
   std::vector<Number>      _src_vals;
+
+  /**
+   * The number of source values which were added on this processor,
+   * as of the last \p prepare_for_use().
+   */
+  std::size_t              _n_local_src_vals;
 };
 
 
@@ -297,6 +313,11 @@ protected:
 
   mutable UniquePtr<kd_tree_t> _kd_tree;
 
+  /**
+   * Functor which interpolates at a range of target points.
+   */
+  class InterpolatePoints;
+
 #endif // LIBMESH_HAVE_NANOFLANN
 
   /**
@@ -306,7 +327,8 @@ protected:
 
   /**
    * Performs inverse distance interpolation at the input point from
-   * the specified points.
+   * the specified points.  Called from several threads at once, so
+   * overrides must be thread safe.
    */
   virtual void interpolate (const Point               & pt,
                             const std::vector<size_t> & src_indices,
@@ -317,9 +339,15 @@ protected:
   const unsigned int _n_interp_pts;
 
   /**
-   * Temporary work array.  Object level scope to avoid cache thrashing.
+   * The target points of the last \p interpolate_field_data() call,
+   * and the indices and squared distances of the \p _n_interp_pts
+   * sources closest to each of them.  These only depend on the
+   * points, so interpolating at the same targets again, e.g. after
+   * \p update_field_data(), skips the KD tree search.
    */
-  mutable std::vector<Number> _vals;
+  mutable std::vector<Point>  _cached_tgt_pts;
+  mutable std::vector<size_t> _cached_src_indices;
+  mutable std::vector<Real>   _cached_src_dist_sqr;
 
 public:
 
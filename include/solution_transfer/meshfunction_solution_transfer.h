@@ -21,6 +21,7 @@
 #include "libmesh/solution_transfer.h"
 
 #include <string>
+#include <vector>
 
 namespace libMesh
 {
@@ -29,8 +30,10 @@ namespace libMesh
  * Implementation of a SolutionTransfer object that only works for
  * transferring the solution using a MeshFunction
  *
- * Note: A serialization of the "from" solution vector will be
- * performed!  This can be slow in parallel and take a lot of memory!
+ * Note: The "from" mesh must be serialized.  Each processor gathers
+ * only the "from" solution values which its own nodes need.  With
+ * \p cache_mappings() set, the points are located only once and each
+ * later transfer is a sparse matrix-vector product.
  *
  * \author Derek Gaston
  * \date 2013
@@ -46,6 +49,40 @@ public:
    * Transfer the values of a variable to another.
    */
   virtual void transfer(const Variable & from_var, const Variable & to_var) libmesh_override;
+
+  virtual void clear_cache () libmesh_override { _interpolation_maps.clear(); }
+
+private:
+
+  /**
+   * The interpolation matrix from the source variable to the target
+   * variable's local nodal values, stored by rows.  Columns index
+   * \p from_indices, the source degrees of freedom which are needed
+   * here.
+   */
+  struct InterpolationMap
+  {
+    dof_id_type from_n_dofs;
+    dof_id_type to_n_dofs;
+    std::vector<numeric_index_type> to_indices;
+    std::vector<std::size_t> row_offsets;
+    std::vector<unsigned int> columns;
+    std::vector<Number> weights;
+    std::vector<numeric_index_type> from_indices;
+  };
+
+  /**
+   * Locates each local node of the target mesh in the source mesh
+   * and fills \p interp with the source shape function values there.
+   */
+  void build_interpolation_map (const Variable & from_var,
+                                const Variable & to_var,
+                                InterpolationMap & interp) const;
+
+  /**
+   * Cached interpolation maps, if \p cache_mappings() is set.
+   */
+  std::map<transfer_key, InterpolationMap> _interpolation_maps;
 };
 
 } // namespace libMesh
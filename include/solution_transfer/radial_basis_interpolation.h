@@ -26,6 +26,7 @@
 #include "libmesh/meshfree_interpolation.h"
 #include "libmesh/radial_basis_functions.h"
 #include "libmesh/bounding_box.h"
+#include "libmesh/eigen_core_support.h"
 
 
 
@@ -71,6 +72,36 @@ protected:
    */
   Real _r_override;
 
+#ifdef LIBMESH_HAVE_EIGEN
+  typedef Eigen::Matrix<Number, Eigen::Dynamic, Eigen::Dynamic, Eigen::ColMajor> DynamicMatrix;
+  typedef Eigen::SparseMatrix<Number, Eigen::ColMajor, eigen_idx_type> SparseRBFMatrix;
+
+  /**
+   * The interpolation matrix, which only depends on the source
+   * points, and how to solve with it: by the LDLT factorization of
+   * its dense copy if \p _solve_dense, by conjugate gradients
+   * otherwise.  Kept so that \p update_field_data() only solves
+   * again.
+   */
+  SparseRBFMatrix _rbf_matrix;
+  bool _solve_dense;
+  Eigen::LDLT<DynamicMatrix> _dense_ldlt;
+  Eigen::ConjugateGradient<SparseRBFMatrix, Eigen::Lower|Eigen::Upper> _cg;
+#endif
+
+  /**
+   * Solves for \p _weights from the current \p _src_vals.
+   */
+  void solve_for_weights ();
+
+  /**
+   * Finds the source points closer to \p p than \p _r_bbox, outside
+   * of which the basis functions vanish, and their squared distances
+   * to \p p, in no particular order.
+   */
+  void find_sources_within_support (const Point & p,
+                                    std::vector<std::pair<size_t, Real> > & neighbors) const;
+
 public:
 
   /**
@@ -81,6 +112,9 @@ public:
     InverseDistanceInterpolation<KDDim> (comm_in,8,2),
     _r_bbox(0.),
     _r_override(radius)
+#ifdef LIBMESH_HAVE_EIGEN
+    , _solve_dense(false)
+#endif
   { libmesh_experimental(); }
 
   /**
@@ -94,6 +128,13 @@ public:
    */
   virtual void prepare_for_use () libmesh_override;
 
+  /**
+   * Replaces the source values, and solves for the basis
+   * coefficients again with the interpolation matrix built by
+   * \p prepare_for_use().
+   */
+  virtual void update_field_data (const std::vector<Number> & vals) libmesh_override;
+
   /**
    * Interpolate source data at target points.
    * Pure virtual, must be overriden in derived classes.
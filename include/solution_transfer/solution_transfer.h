@@ -26,6 +26,7 @@
 
 #include <string>
 #include <map>
+#include <utility>
 
 namespace libMesh {
 
@@ -43,7 +44,8 @@ public:
 
   SolutionTransfer(const libMesh::Parallel::Communicator & comm_in
                    LIBMESH_CAN_DEFAULT_TO_COMMWORLD) :
-    ParallelObject(comm_in)
+    ParallelObject(comm_in),
+    _cache_mappings(false)
   {}
 
   virtual ~SolutionTransfer() {}
@@ -55,6 +57,49 @@ public:
    * even in the case of having different meshes.
    */
   virtual void transfer(const Variable & from_var, const Variable & to_var) = 0;
+
+  /**
+   * Sets whether the mapping between source and target degrees of
+   * freedom is kept for reuse by later transfers between the same
+   * pair of variables.  Off by default.
+   *
+   * A cached mapping is rebuilt automatically if the number of
+   * degrees of freedom in either system changes, but not if a mesh
+   * is moved or repartitioned without changing that number; call
+   * \p clear_cache() in that case.
+   */
+  void cache_mappings (bool cache)
+  { _cache_mappings = cache; if (!cache) this->clear_cache(); }
+
+  /**
+   * \returns Whether transfer mappings are cached.
+   */
+  bool cache_mappings () const { return _cache_mappings; }
+
+  /**
+   * Discards any cached transfer mappings.
+   */
+  virtual void clear_cache () {}
+
+protected:
+
+  /**
+   * Identifies a (from, to) pair of variables in a transfer cache.
+   */
+  typedef std::pair<std::pair<const System *, unsigned int>,
+                    std::pair<const System *, unsigned int> > transfer_key;
+
+  static transfer_key make_transfer_key (const Variable & from_var,
+                                         const Variable & to_var)
+  {
+    return std::make_pair(std::make_pair(from_var.system(), from_var.number()),
+                          std::make_pair(to_var.system(), to_var.number()));
+  }
+
+  /**
+   * Whether mappings are kept between transfers.
+   */
+  bool _cache_mappings;
 };
 
 } // namespace libMesh
@@ -209,6 +209,20 @@ protected:
    * A helper function to calculate error norms
    */
   virtual Real calculate_norm(System &, NumericVector<Number> &);
+
+  /**
+   * Grows or shrinks deltat for the next timestep, within the limits
+   * set above, from the estimated \p global_relative_error (scaled
+   * by deltat) and \p local_relative_error of the step just taken.
+   */
+  void update_deltat (Real global_relative_error,
+                      Real local_relative_error);
+
+  /**
+   * Copies the _old_nonlinear_solution vector into the serial vector
+   * from which the core_time_solver reads it, after it was changed.
+   */
+  void localize_old_nonlinear_solution ();
 };
 
 
@@ -214,6 +214,64 @@ public:
    */
   Real minimum_linear_tolerance;
 
+  /**
+   * If this is set to true, a preconditioner built during one linear
+   * solve is kept and reused for later linear solves, across
+   * nonlinear iterations and across calls to solve(), instead of
+   * being rebuilt from every new Jacobian.  The Jacobian itself is
+   * still reassembled and used as the Krylov operator.  Defaults to
+   * false.
+   *
+   * Only solvers which do their own linear solves, such as
+   * NewtonSolver, honor this setting.
+   */
+  bool reuse_preconditioner;
+
+  /**
+   * When reusing a preconditioner, it is rebuilt for the next linear
+   * solve once a solve takes more than this factor times the number
+   * of iterations the first solve after the last rebuild took, or
+   * once a solve fails to converge.  Defaults to 2.
+   */
+  Real reuse_preconditioner_max_iteration_growth;
+
+  /**
+   * \returns The number of linear solves, since the last init() or
+   * reinit(), which built a new preconditioner.
+   */
+  unsigned int n_preconditioner_builds() const
+  { return _n_preconditioner_builds; }
+
+  /**
+   * \returns The number of linear solves, since the last init() or
+   * reinit(), which reused an earlier preconditioner.
+   */
+  unsigned int n_preconditioner_reuses() const
+  { return _n_preconditioner_reuses; }
+
+  /**
+   * \returns The number of Krylov iterations which solves with a
+   * reused preconditioner took beyond those of the solve which built
+   * it.
+   */
+  unsigned int preconditioner_reuse_extra_iterations() const
+  { return _preconditioner_reuse_extra_iterations; }
+
+  /**
+   * \returns An estimate of the wall time, in seconds, saved by
+   * reusing preconditioners: the average time of a solve which built
+   * its preconditioner, times the number of reuses, less the time
+   * the solves with reused preconditioners actually took.  Extra
+   * Krylov iterations are thereby already accounted for; a negative
+   * value means reuse did not pay off.
+   */
+  double preconditioner_reuse_time_saved() const;
+
+  /**
+   * Prints the preconditioner reuse statistics above to \p os.
+   */
+  void print_preconditioner_reuse_summary(std::ostream & os) const;
+
   /**
    * Enumeration return type for the solve() function.  Multiple SolveResults
    * may be combined (OR'd) in the single return.  To test which ones are present,
@@ -317,6 +375,51 @@ protected:
    */
   sys_type & _system;
 
+  /**
+   * \returns \p true if the next linear solve should reuse the
+   * preconditioner from an earlier one.
+   */
+  bool use_lagged_preconditioner() const
+  { return reuse_preconditioner && _preconditioner_available; }
+
+  /**
+   * Records the outcome of a linear solve for the preconditioner
+   * reuse policy and statistics: whether it \p reused an earlier
+   * preconditioner, how many \p linear_steps it took, whether it
+   * \p converged, and how many seconds it took.
+   */
+  void record_linear_solve(bool reused,
+                           unsigned int linear_steps,
+                           bool converged,
+                           double solve_time);
+
+  /**
+   * Forgets any stored preconditioner and resets the reuse
+   * statistics.
+   */
+  void reset_preconditioner_reuse();
+
+  /**
+   * Whether a preconditioner built by an earlier linear solve is
+   * available to reuse.
+   */
+  bool _preconditioner_available;
+
+  /**
+   * The number of iterations of the linear solve which built the
+   * current preconditioner.
+   */
+  unsigned int _preconditioner_baseline_iterations;
+
+  /**
+   * Preconditioner reuse statistics.
+   */
+  unsigned int _n_preconditioner_builds;
+  unsigned int _n_preconditioner_reuses;
+  unsigned int _preconditioner_reuse_extra_iterations;
+  double _preconditioner_build_solve_time;
+  double _preconditioner_reuse_solve_time;
+
   /**
    * Initialized to zero.  solve_result is typically set internally in
    * the solve() function before it returns.  When non-zero,
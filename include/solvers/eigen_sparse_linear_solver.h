@@ -79,6 +79,29 @@ public:
          const double tol,
          const unsigned int m_its) libmesh_override;
 
+  /**
+   * Call the Eigen solver for each right-hand side, computing the
+   * preconditioner or the SparseLU factorization of \p matrix only
+   * once
+   */
+  virtual std::pair<unsigned int, Real>
+  solve_multiple_rhs (SparseMatrix<T> & matrix,
+                      const std::vector<NumericVector<T> *> & solutions,
+                      const std::vector<NumericVector<T> *> & rhs,
+                      const double tol,
+                      const unsigned int m_its) libmesh_override;
+
+  /**
+   * Transpose \p matrix once, then call solve_multiple_rhs() on the
+   * transpose
+   */
+  virtual std::pair<unsigned int, Real>
+  adjoint_solve_multiple_rhs (SparseMatrix<T> & matrix,
+                              const std::vector<NumericVector<T> *> & solutions,
+                              const std::vector<NumericVector<T> *> & rhs,
+                              const double tol,
+                              const unsigned int m_its) libmesh_override;
+
   /**
    * Call the Eigen solver to solve A^T x = b
    */
@@ -136,6 +159,17 @@ private:
    */
   void set_eigen_preconditioner_type ();
 
+  /**
+   * Solves for every right-hand side with an Eigen iterative \p
+   * solver whose preconditioner has already been computed, keeping
+   * the first failure in \p _comp_info.
+   */
+  template <typename Solver>
+  std::pair<unsigned int, Real>
+  solve_each_rhs (Solver & solver,
+                  const std::vector<NumericVector<T> *> & solutions,
+                  const std::vector<NumericVector<T> *> & rhs);
+
   /**
    * Store the result of the last solve.
    */
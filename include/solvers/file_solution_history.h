@@ -0,0 +1,206 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FILE_SOLUTION_HISTORY_H
+#define LIBMESH_FILE_SOLUTION_HISTORY_H
+
+// Local includes
+#include "libmesh/numeric_vector.h"
+#include "libmesh/solution_history.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * Subclass of Solution History that stores the solutions and other
+ * important vectors of the most recently used timesteps in memory,
+ * and those of all other timesteps in files, so that long transients
+ * fit in a bounded amount of memory.
+ *
+ * Each processor writes the local entries of its vectors to its own
+ * files in a directory, which must exist, in the background while the
+ * solve continues.  The files can be gzip compressed and can hold
+ * single precision values, which loses accuracy in the retrieved
+ * vectors but halves their size; vectors retrieved from memory are
+ * always exact.  The files are removed by the destructor.
+ *
+ * \brief Stores past solutions in memory and in files.
+ */
+class FileSolutionHistory : public SolutionHistory
+{
+public:
+
+  /**
+   * Constructor, reference to system to be passed by user.  At most
+   * \p max_in_memory timesteps are kept in memory, and the rest are
+   * written to files in \p directory.
+   */
+  FileSolutionHistory(System & system_,
+                      const std::string & directory = ".",
+                      unsigned int max_in_memory = 2);
+
+  /**
+   * Destructor
+   */
+  ~FileSolutionHistory();
+
+  /**
+   * Virtual function store which we will be overriding to store timesteps
+   */
+  virtual void store() libmesh_override;
+
+  /**
+   * Virtual function retrieve which we will be overriding to retrieve timesteps
+   */
+  virtual void retrieve() libmesh_override;
+
+  /**
+   * Definition of the clone function needed for the setter function.
+   * The clone gets our settings but none of our stored timesteps.
+   */
+  virtual UniquePtr<SolutionHistory > clone() const libmesh_override;
+
+  /**
+   * Turn on compress to gzip the files, if libMesh was built with
+   * gzstream support.
+   */
+  void set_compress (bool val)
+  { _compress = val; }
+
+  /**
+   * Turn on single_precision to store values in the files in single
+   * precision.
+   */
+  void set_single_precision (bool val)
+  { _single_precision = val; }
+
+private:
+
+  /**
+   * The vectors stored for one timestep, and where they are
+   */
+  struct StoredEntry
+  {
+    StoredEntry (Real time_in, unsigned int id_in) :
+      time(time_in), id(id_in), on_disk(false) {}
+
+    Real time;
+
+    // A number for the file name of this entry
+    unsigned int id;
+
+    // The saved vectors, if we are in memory
+    std::map<std::string, NumericVector<Number> *> vectors;
+
+    // Otherwise the names of the vectors in our file
+    std::vector<std::string> names;
+
+    bool on_disk;
+  };
+
+  typedef std::list<StoredEntry>::iterator stored_solutions_iterator;
+
+  /**
+   * Writes the buffered vectors to a file, on a separate thread
+   */
+  class WriteEntry
+  {
+  public:
+    WriteEntry (FileSolutionHistory & history) : _history(history) {}
+
+    void operator() ();
+
+  private:
+    FileSolutionHistory & _history;
+  };
+
+  // Sets stored_sols to the entry at the current system time, if
+  // there is one
+  void find_stored_entry();
+
+  // The name of the file of an entry on this processor
+  std::string file_name (const StoredEntry & entry) const;
+
+  // Moves an entry in memory to its file
+  void spill (stored_solutions_iterator entry);
+
+  // Reads an entry from its file back into memory, removing the file
+  void unspill (stored_solutions_iterator entry);
+
+  // Reads the vectors of an entry in a file straight into the system
+  void read_into_system (const StoredEntry & entry);
+
+  // Reads the name and local values of each vector in a file
+  void read_file (const StoredEntry & entry,
+                  std::vector<std::string> & names,
+                  std::vector<std::vector<Number> > & values) const;
+
+  // Waits for any file we are writing
+  void finish_writing ();
+
+  // Spills entries until at most _max_in_memory are left in memory
+  void enforce_memory_limit ();
+
+  // This list holds the current time and stored vectors from each
+  // timestep
+  std::list<StoredEntry> stored_solutions;
+
+  // The stored solutions iterator
+  stored_solutions_iterator stored_sols;
+
+  // The entries in memory
+  std::list<stored_solutions_iterator> _in_memory;
+
+  // A system reference
+  System & _system;
+
+  std::string _directory;
+
+  unsigned int _max_in_memory;
+
+  bool _compress;
+
+  bool _single_precision;
+
+  // A number for our file names, unique among the histories of this
+  // processor
+  unsigned int _history_id;
+
+  // The next entry number for file names
+  unsigned int _next_entry_id;
+
+  // The file, vector names and local values being written
+  std::string _write_file_name;
+  std::vector<std::string> _write_names;
+  std::vector<std::vector<Number> > _write_values;
+
+  // The thread doing the writing, if any
+  UniquePtr<Threads::Thread> _write_thread;
+};
+
+} // end namespace libMesh
+
+#endif // LIBMESH_FILE_SOLUTION_HISTORY_H
@@ -176,6 +176,39 @@ public:
                                                        const double,      // Stopping tolerance
                                                        const unsigned int); // N. Iterations
 
+  /**
+   * Solves \p matrix * \p solutions[i] = \p rhs[i] for every \p i,
+   * using each entry of \p solutions as the initial guess.  The
+   * preconditioner or factorization of \p matrix is set up once and
+   * shared by all the solves.  The default implementation solves one
+   * right-hand side after another, reusing the preconditioner after
+   * the first.  Afterwards get_converged_reason() reports a failure
+   * if any of the solves diverged.
+   *
+   * \returns The largest number of iterations and the largest final
+   * residual of any of the solves.
+   */
+  virtual std::pair<unsigned int, Real> solve_multiple_rhs (SparseMatrix<T> & matrix,
+                                                            const std::vector<NumericVector<T> *> & solutions,
+                                                            const std::vector<NumericVector<T> *> & rhs,
+                                                            const double tol,
+                                                            const unsigned int n_iter);
+
+  /**
+   * Solves the adjoint systems \p matrix^T * \p solutions[i] = \p
+   * rhs[i] for every \p i, sharing a single preconditioner setup
+   * like solve_multiple_rhs() does.  The default implementation
+   * calls adjoint_solve() for one right-hand side after another.
+   *
+   * \returns The largest number of iterations and the largest final
+   * residual of any of the solves.
+   */
+  virtual std::pair<unsigned int, Real> adjoint_solve_multiple_rhs (SparseMatrix<T> & matrix,
+                                                                    const std::vector<NumericVector<T> *> & solutions,
+                                                                    const std::vector<NumericVector<T> *> & rhs,
+                                                                    const double tol,
+                                                                    const unsigned int n_iter);
+
   /**
    * This function calls the solver
    * "_solver_type" preconditioned with the
@@ -254,6 +287,21 @@ public:
    */
   void set_solver_configuration(SolverConfiguration & solver_configuration);
 
+  /**
+   * Enables iterative refinement: rather than asking the Krylov
+   * solver for the full tolerance at once, each inner solve only
+   * reduces its residual by \p inner_tolerance, and the true residual
+   * b - A*x is recomputed from the operator before the next
+   * correction, until it has dropped by the requested solve tolerance
+   * or \p max_refinements corrections have been made.  If an inner
+   * solve diverges its correction is discarded, refinement stops, and
+   * \p get_converged_reason() reports the divergence.  An
+   * \p inner_tolerance of 0 disables refinement, which is the
+   * default.  Solvers which do not support it ignore the setting.
+   */
+  void set_iterative_refinement (const Real inner_tolerance,
+                                 const unsigned int max_refinements = 10);
+
 protected:
 
 
@@ -290,6 +338,17 @@ protected:
    * to set parameters like solver type, tolerances and iteration limits.
    */
   SolverConfiguration * _solver_configuration;
+
+  /**
+   * The relative tolerance of each inner solve when iterative
+   * refinement is enabled, or 0 if it is not.
+   */
+  Real _refinement_inner_tolerance;
+
+  /**
+   * The maximum number of refinement corrections per solve.
+   */
+  unsigned int _max_refinements;
 };
 
 
@@ -305,7 +364,9 @@ LinearSolver<T>::LinearSolver (const libMesh::Parallel::Communicator & comm_in)
   _is_initialized      (false),
   _preconditioner      (libmesh_nullptr),
   same_preconditioner  (false),
-  _solver_configuration(libmesh_nullptr)
+  _solver_configuration(libmesh_nullptr),
+  _refinement_inner_tolerance(0.),
+  _max_refinements     (10)
 {
 }
 
@@ -75,7 +75,9 @@ public:
    */
   virtual UniquePtr<SolutionHistory > clone() const libmesh_override
   {
-    return UniquePtr<SolutionHistory >(new MemorySolutionHistory(_system));
+    MemorySolutionHistory * history = new MemorySolutionHistory(_system);
+    history->set_overwrite_previously_stored(overwrite_previously_stored);
+    return UniquePtr<SolutionHistory >(history);
   }
 
 private:
@@ -32,6 +32,7 @@
 #include "nlopt.h"
 
 // C++ includes
+#include <vector>
 
 namespace libMesh
 {
@@ -150,6 +151,18 @@ protected:
 
 private:
 
+  /**
+   * Makes the system solution and its current_local_solution
+   * consistent with the NLopt iterate \p x of size \p n, unless
+   * they already are.
+   */
+  void update_system_solution (unsigned n, const double * x);
+
+  /**
+   * The iterate the system solution was last updated to.
+   */
+  std::vector<double> _cached_x;
+
   // Make NLopt callback functions friends
   friend double __libmesh_nlopt_objective (unsigned n,
                                            const double * x,
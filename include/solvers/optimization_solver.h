@@ -194,6 +194,13 @@ public:
    */
   bool verbose;
 
+  /**
+   * If true, \p solve() starts from the current system solution,
+   * e.g. the optimum of a previous solve in an outer loop, instead
+   * of from zero.  False by default.
+   */
+  bool warm_start;
+
 protected:
 
   /**
@@ -0,0 +1,187 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_PARAREAL_SOLVER_H
+#define LIBMESH_PARAREAL_SOLVER_H
+
+// Local includes
+#include "libmesh/auto_ptr.h"
+#include "libmesh/libmesh_common.h"
+#include "libmesh/numeric_vector.h"
+#include "libmesh/parallel.h"
+#include "libmesh/reference_counted_object.h"
+#include "libmesh/unsteady_solver.h"
+
+// C++ includes
+
+namespace libMesh
+{
+
+// Forward Declarations
+class DifferentiableSystem;
+
+/**
+ * This class integrates a DifferentiableSystem in time with the
+ * parareal method, parallelizing over time as well as space.
+ *
+ * The time interval is split into one time slice per rank of a
+ * "time" communicator.  Each slice is integrated by its own copy of
+ * the mesh and system, distributed on a "space" communicator, with
+ * the system's (fine) UnsteadySolver, while a cheap coarse
+ * UnsteadySolver (e.g. an EulerSolver taking a few large steps)
+ * propagates corrections from slice to slice.  After k corrections
+ * the first k+1 slices agree with a serial fine integration; usually
+ * far fewer corrections than slices are needed.
+ *
+ * The processors are typically split as
+ *
+ * \code
+ * // n_space processors per time slice
+ * Parallel::Communicator space_comm, time_comm;
+ * init.comm().split(init.comm().rank() / n_space, init.comm().rank(), space_comm);
+ * init.comm().split(init.comm().rank() % n_space, init.comm().rank(), time_comm);
+ * \endcode
+ *
+ * with the mesh built and partitioned identically on each space_comm,
+ * so that the processors which share a rank in time_comm own the same
+ * degrees of freedom and slice states can be passed between them
+ * directly.
+ *
+ * Only system.solution is passed between slices, so this works with
+ * first order time solvers, and the fine solver must not reduce
+ * deltat on DiffSolver failures.  To keep the fine trajectory of a
+ * slice, give the fine solver a MemorySolutionHistory with
+ * set_overwrite_previously_stored(true); each fine sweep replaces the
+ * states of the previous one.
+ *
+ * This class is part of the new DifferentiableSystem framework,
+ * which is still experimental.  Users of this framework should
+ * beware of bugs and future API changes.
+ */
+class PararealSolver : public ReferenceCountedObject<PararealSolver>
+{
+public:
+  /**
+   * The type of system
+   */
+  typedef DifferentiableSystem sys_type;
+
+  /**
+   * Constructor.  Requires a reference to the system to be solved,
+   * whose time solver is used as the fine solver, and to the
+   * communicator connecting the time slices.
+   */
+  PararealSolver (sys_type & s,
+                  const Parallel::Communicator & time_comm);
+
+  /**
+   * Destructor.
+   */
+  ~PararealSolver ();
+
+  /**
+   * Initializes the coarse time solver.  Call this after the system
+   * has been initialized and coarse_time_solver has been set.
+   */
+  void init ();
+
+  /**
+   * Integrates from the current system.time, at which every slice
+   * must hold the same initial condition, to \p end_time.
+   *
+   * On return each slice holds its fine solution at the end of its
+   * slice, and system.time is the end time of the slice.
+   *
+   * \returns The number of parareal corrections taken.
+   */
+  unsigned int solve (Real end_time);
+
+  /**
+   * The solver used to propagate corrections between time slices.
+   * This must be set by the user, and must be constructed on the same
+   * system as the fine solver.
+   */
+  UniquePtr<UnsteadySolver> coarse_time_solver;
+
+  /**
+   * The number of coarse and fine timesteps to take per time slice.
+   * Default to 1 and 10.
+   */
+  unsigned int n_coarse_steps;
+  unsigned int n_fine_steps;
+
+  /**
+   * The maximum number of parareal corrections.  Defaults to the
+   * number of time slices less one, after which the solution is exact.
+   */
+  unsigned int max_iterations;
+
+  /**
+   * The iteration stops once the l2 norm of the change in each slice's
+   * initial state, relative to the norm of that state, is below this.
+   * Defaults to 1e-8.
+   */
+  Real relative_tolerance;
+
+  /**
+   * Print extra debugging information if quiet == false.
+   */
+  bool quiet;
+
+protected:
+
+  /**
+   * Sets the system solution, and the old solution of \p solver, to
+   * \p state at time \p time.
+   */
+  void set_state (UnsteadySolver & solver,
+                  const NumericVector<Number> & state,
+                  Real time);
+
+  /**
+   * Integrates from \p state at time \p time to \p time_end with the
+   * coarse or the fine solver, leaving the result in system.solution.
+   */
+  void propagate (bool coarse,
+                  const NumericVector<Number> & state,
+                  Real time,
+                  Real time_end);
+
+  /**
+   * Sends the slice state \p state to the next and receives it from
+   * the previous time slice.
+   */
+  void send_state (const NumericVector<Number> & state);
+  void receive_state (NumericVector<Number> & state);
+
+  /**
+   * A reference to the system we are solving.
+   */
+  sys_type & _system;
+
+  /**
+   * The communicator connecting the time slices.
+   */
+  const Parallel::Communicator & _time_comm;
+};
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_PARAREAL_SOLVER_H
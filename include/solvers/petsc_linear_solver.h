@@ -248,6 +248,17 @@ private:
    */
   void set_petsc_solver_type ();
 
+  /**
+   * Solves with the operators already set on \p _ksp by iterative
+   * refinement, stopping once the true residual has dropped by
+   * \p tol.  Accumulates the inner iterations in \p its and returns
+   * the final true residual norm in \p final_resid.  Stops without
+   * applying the correction if an inner solve diverges, leaving its
+   * reason for \p get_converged_reason().
+   */
+  void _solve_with_refinement (Vec rhs, Vec solution, const Real tol,
+                               PetscInt & its, PetscReal & final_resid);
+
   /**
    * Internal function if shell matrix mode is used.
    */
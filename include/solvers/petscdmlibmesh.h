@@ -17,10 +17,17 @@
  * The following functions are called in PetscNonlinear Solver (others can be called by users):
  * DMlibMeshSetSystem(), DMlibMeshGetSystem()
  *
+ * DMlibMeshSetCoarseDM() attaches a DMlibMesh on a coarser mesh as the
+ * next level of a geometric multigrid hierarchy, which DMCoarsen()
+ * then returns.  The finer mesh must have been refined from a copy of
+ * the coarser one, and the interpolation between the levels is built
+ * from the refinement tree (LAGRANGE variables only).
+ *
  * Any implementation needs to register its creation routine, DMCreate_libMesh, with PETSc using DMRegister().
  */
 PETSC_EXTERN PetscErrorCode DMlibMeshSetSystem(DM,libMesh::NonlinearImplicitSystem &);
 PETSC_EXTERN PetscErrorCode DMlibMeshGetSystem(DM,libMesh::NonlinearImplicitSystem *&);
+PETSC_EXTERN PetscErrorCode DMlibMeshSetCoarseDM(DM,DM);
 
 
 #define DMLIBMESH "libmesh"
@@ -0,0 +1,98 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_PREDICTOR_TIME_SOLVER_H
+#define LIBMESH_PREDICTOR_TIME_SOLVER_H
+
+// Local includes
+#include "libmesh/adaptive_time_solver.h"
+
+// C++ includes
+
+namespace libMesh
+{
+
+/**
+ * This class wraps an EulerSolver and adjusts future timestep lengths
+ * from the difference between each timestep's solution and a linear
+ * extrapolation of the last two solutions.  For a theta method with
+ * theta != 0.5 both are first order accurate in time and their
+ * leading error terms are known multiples of each other, so the
+ * difference gives an error estimate without any solves beyond the
+ * timestep itself.  The extrapolation is also the initial guess for
+ * the timestep.
+ *
+ * That makes adaptive timestepping about as cheap as fixed
+ * timestepping, where TwostepTimeSolver takes three solves per
+ * timestep, but the estimate needs smooth solutions: it cannot see
+ * errors which the last two timesteps did not hint at.  The first
+ * timestep, which has nothing to extrapolate from, keeps its deltat.
+ *
+ * Currently this class only works on fully coupled Systems
+ *
+ * This class is part of the new DifferentiableSystem framework,
+ * which is still experimental.  Users of this framework should
+ * beware of bugs and future API changes.
+ */
+class PredictorTimeSolver : public AdaptiveTimeSolver
+{
+public:
+  /**
+   * The parent class
+   */
+  typedef AdaptiveTimeSolver Parent;
+
+  /**
+   * Constructor. Requires a reference to the system
+   * to be solved.
+   */
+  explicit
+  PredictorTimeSolver (sys_type & s);
+
+  /**
+   * Destructor.
+   */
+  ~PredictorTimeSolver ();
+
+  virtual void init() libmesh_override;
+
+  virtual void solve() libmesh_override;
+
+  virtual void advance_timestep() libmesh_override;
+
+protected:
+
+  /**
+   * Sets \p v to the linear extrapolation of the solutions at the
+   * last two timesteps to the end of the current one.
+   */
+  void extrapolate (NumericVector<Number> & v) const;
+
+  /**
+   * The length of the last timestep which advance_timestep() was
+   * called for, or 0 if there has been none yet.
+   */
+  Real _previous_deltat;
+};
+
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_PREDICTOR_TIME_SOLVER_H
@@ -26,6 +26,7 @@
 
 // Local includes
 #include "libmesh/eigen_solver.h"
+#include "libmesh/petsc_macro.h"
 #include "libmesh/slepc_macro.h"
 
 // SLEPc include files.
@@ -212,8 +213,30 @@ public:
    */
   EPS eps() { this->init(); return _eps; }
 
+  /**
+   * Makes the next solves compute all the eigenvalues in the interval
+   * [\p lower, \p upper] by SLEPc's spectral slicing: Krylov-Schur
+   * with shift-and-invert, the interval being split among \p
+   * n_partitions sub-communicators which are solved concurrently.
+   * This needs a symmetric (generalized) problem and a direct solver
+   * which can compute matrix inertia, e.g. Cholesky through MUMPS.
+   * Call with \p n_partitions = 0 to go back to the position of the
+   * spectrum set with \p set_position_of_spectrum() and to the
+   * default spectral transformation; the interval is then ignored.
+   * Requires SLEPc 3.7 or newer.
+   */
+  void set_spectral_slicing (Real lower,
+                             Real upper,
+                             unsigned int n_partitions = 1);
+
 private:
 
+#if PETSC_RELEASE_LESS_THAN(3,5,0)
+  typedef PetscInt OperatorState;
+#else
+  typedef PetscObjectState OperatorState;
+#endif
+
   /**
    * Helper function that actually performs the standard eigensolve.
    */
@@ -251,6 +274,17 @@ private:
    */
   void set_slepc_position_of_spectrum();
 
+  /**
+   * Hands \p mat_A and \p mat_B (which may be \p PETSC_NULL) to
+   * SLEPc, unless they are the operators of the last solve and
+   * haven't been modified since.  Resetting the operators would
+   * discard the spectral transformation setup, including any
+   * factorization.  With unchanged operators only a changed target
+   * is passed on, as a new shift, which keeps the symbolic
+   * factorization.
+   */
+  void set_slepc_operators (Mat mat_A, Mat mat_B);
+
   /**
    * Internal function if shell matrix mode is used, this just
    * calls the shell matrix's matrix multiplication function.
@@ -270,6 +304,23 @@ private:
    */
   EPS _eps;
 
+  /**
+   * The operators of the last solve, their states at that time, and
+   * the target the solve used.
+   */
+  Mat _operator_A;
+  Mat _operator_B;
+  OperatorState _operator_A_state;
+  OperatorState _operator_B_state;
+  Real _operator_target;
+
+  /**
+   * The spectral slicing interval and number of partitions, which is
+   * zero if we aren't slicing.
+   */
+  Real _slice_lower;
+  Real _slice_upper;
+  unsigned int _slice_partitions;
 };
 
 
@@ -277,7 +328,15 @@ private:
 template <typename T>
 inline
 SlepcEigenSolver<T>::SlepcEigenSolver (const Parallel::Communicator & comm_in) :
-  EigenSolver<T>(comm_in)
+  EigenSolver<T>(comm_in),
+  _operator_A(PETSC_NULL),
+  _operator_B(PETSC_NULL),
+  _operator_A_state(0),
+  _operator_B_state(0),
+  _operator_target(0.),
+  _slice_lower(0.),
+  _slice_upper(0.),
+  _slice_partitions(0)
 {
   this->_eigen_solver_type  = ARNOLDI;
   this->_eigen_problem_type = NHEP;
@@ -0,0 +1,147 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_SSPRK_SOLVER_H
+#define LIBMESH_SSPRK_SOLVER_H
+
+// Local includes
+#include "libmesh/first_order_unsteady_solver.h"
+
+// C++ includes
+
+namespace libMesh
+{
+
+/**
+ * This class defines an explicit, strong stability preserving
+ * Runge-Kutta (SSP-RK) solver to handle time integration of
+ * DifferentiableSystems.
+ *
+ * The mass matrix is lumped by summing its rows, once, and again
+ * only after the mesh changes; each stage then takes one residual
+ * assembly and a pointwise update, with no linear or nonlinear
+ * solve.
+ *
+ * Every variable must be time evolving with a mass which lumps to
+ * nonzero diagonal entries.  Constrained degrees of freedom are set by
+ * the DofMap constraints after each stage.  Moving meshes, second
+ * order variables and adjoint solves are not supported.
+ *
+ * This class is part of the new DifferentiableSystem framework,
+ * which is still experimental.  Users of this framework should
+ * beware of bugs and future API changes.
+ */
+class SSPRKSolver : public FirstOrderUnsteadySolver
+{
+public:
+  /**
+   * The parent class
+   */
+  typedef FirstOrderUnsteadySolver Parent;
+
+  /**
+   * Constructor. Requires a reference to the system
+   * to be solved.
+   */
+  explicit
+  SSPRKSolver (sys_type & s);
+
+  /**
+   * Destructor.
+   */
+  virtual ~SSPRKSolver ();
+
+  virtual void init () libmesh_override;
+
+  /**
+   * Marks the lumped mass for recomputation, since the mesh has
+   * changed.
+   */
+  virtual void reinit () libmesh_override;
+
+  /**
+   * Takes an explicit timestep from the old solution.  No DiffSolver
+   * is used.
+   */
+  virtual void solve () libmesh_override;
+
+  /**
+   * Error convergence order: the order of the scheme.
+   */
+  virtual Real error_order() const libmesh_override;
+
+  /**
+   * These methods use the DifferentiablePhysics' *_time_derivative()
+   * methods at the current (stage) solution to build a residual, or
+   * their *_mass_residual() methods to build the lumped mass.
+   */
+  virtual bool element_residual (bool request_jacobian,
+                                 DiffContext &) libmesh_override;
+
+  virtual bool side_residual (bool request_jacobian,
+                              DiffContext &) libmesh_override;
+
+  virtual bool nonlocal_residual (bool request_jacobian,
+                                  DiffContext &) libmesh_override;
+
+  /**
+   * The order of the SSP-RK scheme: 1 is forward Euler, 2 and 3 are
+   * the two and three stage schemes of Shu and Osher.  Defaults to 3.
+   */
+  unsigned int order;
+
+protected:
+
+  /**
+   * This method is the underlying implementation of the public
+   * residual methods.
+   */
+  virtual bool _general_residual (bool request_jacobian,
+                                  DiffContext &,
+                                  ResFuncType mass,
+                                  ResFuncType time_deriv,
+                                  ReinitFuncType reinit_func);
+
+  /**
+   * Assembles the row sum lumped mass and stores its inverse.
+   */
+  void compute_lumped_mass ();
+
+  /**
+   * Sets system.solution to solution + deltat * M^{-1} f(solution),
+   * with f evaluated at time \p time.
+   */
+  void explicit_stage (Real time);
+
+  /**
+   * Whether we are assembling the lumped mass rather than a
+   * residual.
+   */
+  bool _computing_lumped_mass;
+
+  /**
+   * Whether "_inverse_lumped_mass" is up to date with the mesh.
+   */
+  bool _lumped_mass_valid;
+};
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_SSPRK_SOLVER_H
@@ -116,6 +116,15 @@ public:
    */
   virtual int get_converged_reason() libmesh_override;
 
+  /**
+   * If true, the Hessian object is ignored, and Tao's limited memory
+   * variable metric method (BLMVM if there are bounds, LMVM
+   * otherwise) builds a quasi-Newton approximation from gradients
+   * instead, so no Hessian is ever assembled.  A -tao_type given on
+   * the command line still takes precedence.  False by default.
+   */
+  bool quasi_newton;
+
 protected:
 
   /**
@@ -134,6 +143,38 @@ protected:
 
 private:
 
+  /**
+   * Makes the system solution and its current_local_solution
+   * consistent with the Tao iterate \p x, unless they already are.
+   * Drops the cached evaluations if \p x is a new iterate.
+   */
+  void update_system_solution (Vec x);
+
+  /**
+   * Drops the cached iterate and evaluations.
+   */
+  void clear_cache ();
+
+  /**
+   * The iterate the system solution was last updated to, and its
+   * state at that time.  We keep a reference to it, so its address
+   * can't be reused by another vector.
+   */
+  Vec _cached_x;
+  PetscObjectState _cached_x_state;
+
+  /**
+   * The objective, gradient and Hessian at \p _cached_x, valid if the
+   * corresponding flags are set.  Tao often asks for these more than
+   * once at the same iterate, e.g. at the end of a line search.
+   */
+  bool _objective_cached;
+  PetscReal _cached_objective;
+  bool _gradient_cached;
+  Vec _cached_gradient;
+  Mat _cached_hessian;
+  PetscObjectState _cached_hessian_state;
+
   friend PetscErrorCode __libmesh_tao_objective (Tao tao, Vec x, PetscReal * objective, void * ctx);
   friend PetscErrorCode __libmesh_tao_gradient(Tao tao, Vec x, Vec g, void * ctx);
   friend PetscErrorCode __libmesh_tao_hessian(Tao tao, Vec x, Mat h, Mat pc, void * ctx);
@@ -40,6 +40,12 @@ class System;
  *
  * Currently this class only works on fully coupled Systems
  *
+ * When a timestep is rejected, the first of its two half-length
+ * steps is kept as the solution of the next, halved, timestep, so
+ * each retry costs two solves rather than three.  Setting \p
+ * reuse_preconditioner on the diff_solver() also keeps the
+ * preconditioner across the attempts.
+ *
  * This class is part of the new DifferentiableSystem framework,
  * which is still experimental.  Users of this framework should
  * beware of bugs and future API changes.
@@ -91,6 +91,14 @@ public:
    */
   dof_id_type n_global_non_condensed_dofs() const;
 
+  /**
+   * Reinitializes the member data fields associated with
+   * the system, so that, e.g., \p assemble() may be used.
+   * The condensed matrices are extracted from scratch on the next
+   * solve, since the sparsity pattern may have changed.
+   */
+  virtual void reinit () libmesh_override;
+
   /**
    * Override to solve the condensed eigenproblem with
    * the dofs in local_non_condensed_dofs_vector
@@ -123,6 +131,16 @@ public:
    */
   std::vector<dof_id_type> local_non_condensed_dofs_vector;
 
+  /**
+   * If true, solve() does not extract \p condensed_matrix_A and
+   * \p condensed_matrix_B, but hands the eigensolver shell matrices
+   * which apply the full system matrices to the non-condensed dofs.
+   * This avoids storing a second copy of the matrices, at the cost
+   * of spectral transformations which need the condensed matrices
+   * explicitly.  Defaults to false.
+   */
+  bool use_shell_matrices;
+
 private:
 
   /**
@@ -130,6 +148,13 @@ private:
    * have been initialized.
    */
   bool condensed_dofs_initialized;
+
+  /**
+   * A private flag to indicate whether the condensed matrices have
+   * been extracted with the current non-condensed dofs and matrix
+   * sparsity pattern, so that re-solves can reuse their structure.
+   */
+  bool condensed_matrices_initialized;
 };
 
 
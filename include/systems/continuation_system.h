@@ -84,6 +84,11 @@ public:
    */
   virtual void clear () libmesh_override;
 
+  /**
+   * Reinitializes the system, discarding any lagged Jacobian.
+   */
+  virtual void reinit () libmesh_override;
+
   /**
    * Perform a standard "solve" of the system, without doing continuation.
    */
@@ -255,6 +260,18 @@ public:
    */
   bool newton_progress_check;
 
+  /**
+   * The number of Newton steps of the augmented system (or tangent
+   * solves) a Jacobian is used for before it is reassembled.  The
+   * default, 1, assembles a new Jacobian at every step.  Larger
+   * values lag the Jacobian, along with the factorization or
+   * preconditioner built from it, across Newton steps and from one
+   * arcstep to the next; this trades possibly more (chord) iterations
+   * for fewer assemblies and factorizations.  A fresh Jacobian is
+   * always assembled after a failed arcstep.
+   */
+  unsigned int jacobian_lag;
+
 protected:
   /**
    * Initializes the member data fields associated with
@@ -328,6 +345,25 @@ private:
    */
   void apply_predictor();
 
+  /**
+   * Solves \f$ G_u x = \f$ \p rhs for one of the right-hand sides of
+   * the bordered system.  Unless \p new_jacobian is true, the solve
+   * reuses the preconditioner (e.g. the factorization) of the
+   * previous solve, so the two right-hand sides \f$ -G \f$ and
+   * \f$ G_{\lambda} \f$ of a Newton step share a single setup.
+   */
+  std::pair<unsigned int, Real> bordered_solve (NumericVector<Number> & x,
+                                                Real tol,
+                                                unsigned int max_its,
+                                                bool new_jacobian);
+
+  /**
+   * Decides whether the next Newton step or tangent solve needs a new
+   * Jacobian, according to \p jacobian_lag, and counts the use of the
+   * current one otherwise.
+   */
+  bool need_jacobian ();
+
   /**
    * Extra work vectors used by the continuation algorithm.
    * These are added to the system by the init_data() routine.
@@ -422,6 +458,13 @@ private:
    * Loop counter for nonlinear (Newton) iteration loop.
    */
   unsigned int newton_step;
+
+  /**
+   * The number of Newton steps and tangent solves the current
+   * Jacobian has been used for, or \p invalid_uint if there is no
+   * current Jacobian.
+   */
+  unsigned int jacobian_age;
 };
 
 } // namespace libMesh
@@ -23,6 +23,9 @@
 // Local Includes
 #include "libmesh/fem_context.h"
 
+// C++ includes
+#include <algorithm>
+
 
 namespace libMesh
 {
@@ -288,6 +291,19 @@ private:
    */
   std::vector<FEAbstract *> _neighbor_side_fe_var;
 
+  /**
+   * Neighbor side FE objects skipped by the latest
+   * neighbor_side_fe_reinit() because nothing had been requested from
+   * them; see FEMContext::set_lazy_fe_reinit().
+   */
+  mutable std::vector<FEAbstract *> _pending_neighbor_side_fe;
+
+  /**
+   * Reinitializes the neighbor side FE object \p fe at the inverse
+   * mapped quadrature points of the current side.
+   */
+  void neighbor_fe_reinit(FEAbstract * fe) const;
+
   /**
    * Boolean flag to indicate whether or not the DG terms have been
    * assembled and should be used in the global matrix assembly.
@@ -300,7 +316,21 @@ inline
 void DGFEMContext::get_neighbor_side_fe( unsigned int var, FEGenericBase<OutputShape> *& fe ) const
 {
   libmesh_assert_less ( var, _neighbor_side_fe_var.size() );
-  fe = cast_ptr<FEGenericBase<OutputShape> *>( _neighbor_side_fe_var[var] );
+
+  FEAbstract * neighbor_fe = _neighbor_side_fe_var[var];
+  if (!_pending_neighbor_side_fe.empty())
+    {
+      std::vector<FEAbstract *>::iterator it =
+        std::find(_pending_neighbor_side_fe.begin(),
+                  _pending_neighbor_side_fe.end(), neighbor_fe);
+      if (it != _pending_neighbor_side_fe.end())
+        {
+          _pending_neighbor_side_fe.erase(it);
+          this->neighbor_fe_reinit(neighbor_fe);
+        }
+    }
+
+  fe = cast_ptr<FEGenericBase<OutputShape> *>( neighbor_fe );
 }
 
 } // namespace libMesh
@@ -85,7 +85,8 @@ public:
   enum WriteFlags { WRITE_DATA             = 1,
                     WRITE_ADDITIONAL_DATA  = 2,
                     WRITE_PARALLEL_FILES   = 4,
-                    WRITE_SERIAL_FILES     = 8 };
+                    WRITE_SERIAL_FILES     = 8,
+                    WRITE_CHUNKED_FILES    = 16 };
 
   /**
    * Constructor.
@@ -332,6 +333,10 @@ public:
    * If XdrMODE is omitted, it will be inferred as READ for filenames
    * containing .xda or as DECODE for filenames containing .xdr
    *
+   * Filenames ending in .h5 are read with HDF5IO, on any number of
+   * processors; READ_ADDITIONAL_DATA decides whether vectors other
+   * than the solution are read.
+   *
    * \param name Name of the file to be read.
    * \param read_flags Single flag created by bitwise-OR'ing several flags together.
    * \param mode Controls whether reading is done in binary or ascii mode.
@@ -376,9 +381,18 @@ public:
    * Note that the solution data can be omitted by calling
    * this routine with WRITE_DATA omitted in the write_flags argument.
    *
+   * With WRITE_CHUNKED_FILES every processor writes the data of its
+   * own nodes and elements, by id, to a file of its own, which need
+   * not be gathered anywhere and can be read back in parallel on any
+   * number of processors.
+   *
    * If XdrMODE is omitted, it will be inferred as WRITE for filenames
    * containing .xda or as ENCODE for filenames containing .xdr
    *
+   * Filenames ending in .h5 are written with HDF5IO, with the mesh
+   * for post-processing, and WRITE_ADDITIONAL_DATA as the only flag
+   * which matters.
+   *
    * \param name Name of the file to be read.
    * \param write_flags Single flag created by bitwise-OR'ing several flags together.
    * \param mode Controls whether reading is done in binary or ascii mode.
@@ -339,7 +339,8 @@ public:
 
   /**
    * Fills a vector of values of the _system_vector at the all the quadrature
-   * points in the current element interior.
+   * points in the current element interior.  The vector is resized to
+   * the number of quadrature points.
    */
   template<typename OutputType>
   void interior_values(unsigned int var,
@@ -952,6 +953,21 @@ public:
   void set_custom_solution(const NumericVector<Number> * custom_sol)
   { _custom_solution = custom_sol; }
 
+  /**
+   * Setting which determines whether side_fe_reinit() and
+   * edge_fe_reinit() skip the FE objects from which no data has been
+   * requested yet (see FEAbstract::has_requested_data()).  A skipped
+   * object is reinitialized when it is first fetched through
+   * get_side_fe() or get_edge_fe(), so physics which prerequest their
+   * shape functions only pay for the FE types they use on each side.
+   * Code which keeps its own pointers to side or edge FE objects must
+   * prerequest their data before enabling this.  Off by default.
+   */
+  void set_lazy_fe_reinit(bool lazy)
+  { _lazy_fe_reinit = lazy; }
+
+  bool lazy_fe_reinit() const { return _lazy_fe_reinit; }
+
   /**
    * System from which to acquire moving mesh information
    */
@@ -984,6 +1000,32 @@ protected:
    */
   const NumericVector<Number> * _custom_solution;
 
+  /**
+   * Whether side and edge FE objects are reinitialized on demand
+   */
+  bool _lazy_fe_reinit;
+
+  /**
+   * The side and edge FE objects skipped by the latest
+   * side_fe_reinit() and edge_fe_reinit(), and the side and edge they
+   * were skipped on.
+   */
+  mutable std::vector<FEAbstract *> _pending_side_fe;
+  mutable std::vector<FEAbstract *> _pending_edge_fe;
+  unsigned char _pending_side;
+  unsigned char _pending_edge;
+
+  /**
+   * Reinitializes \p fe if the latest side or edge reinit skipped it.
+   */
+  void reinit_pending_fe(FEAbstract * fe) const
+  {
+    if (!_pending_side_fe.empty() || !_pending_edge_fe.empty())
+      this->_do_reinit_pending_fe(fe);
+  }
+
+  void _do_reinit_pending_fe(FEAbstract * fe) const;
+
   /**
    * Helper function to reduce some code duplication in the *_point_* methods.
    */
@@ -1192,6 +1234,7 @@ void FEMContext::get_side_fe( unsigned int var, FEGenericBase<OutputShape> *& fe
 {
   libmesh_assert( !_side_fe_var[dim].empty() );
   libmesh_assert_less ( var, (_side_fe_var[dim].size() ) );
+  this->reinit_pending_fe(_side_fe_var[dim][var]);
   fe = cast_ptr<FEGenericBase<OutputShape> *>( (_side_fe_var[dim][var] ) );
 }
 
@@ -1200,6 +1243,7 @@ FEBase * FEMContext::get_side_fe( unsigned int var, unsigned char dim ) const
 {
   libmesh_assert( !_side_fe_var[dim].empty() );
   libmesh_assert_less ( var, (_side_fe_var[dim].size() ) );
+  this->reinit_pending_fe(_side_fe_var[dim][var]);
   return cast_ptr<FEBase *>( (_side_fe_var[dim][var] ) );
 }
 
@@ -1208,6 +1252,7 @@ inline
 void FEMContext::get_edge_fe( unsigned int var, FEGenericBase<OutputShape> *& fe ) const
 {
   libmesh_assert_less ( var, _edge_fe_var.size() );
+  this->reinit_pending_fe(_edge_fe_var[var]);
   fe = cast_ptr<FEGenericBase<OutputShape> *>( _edge_fe_var[var] );
 }
 
@@ -1215,6 +1260,7 @@ inline
 FEBase * FEMContext::get_edge_fe( unsigned int var ) const
 {
   libmesh_assert_less ( var, _edge_fe_var.size() );
+  this->reinit_pending_fe(_edge_fe_var[var]);
   return cast_ptr<FEBase *>( _edge_fe_var[var] );
 }
 
@@ -26,13 +26,18 @@
 
 // C++ includes
 #include <cstddef>
+#include <map>
+#include <utility>
+#include <vector>
 
 namespace libMesh
 {
 
 // Forward Declarations
 class DiffContext;
+class ErrorVector;
 class FEMContext;
+template <typename T> class ShellMatrix;
 
 
 /**
@@ -97,6 +102,62 @@ public:
    */
   virtual void solve () libmesh_override;
 
+  /**
+   * Reinitializes the member data fields associated with
+   * the system, and discards any cached assembly coloring.
+   */
+  virtual void reinit () libmesh_override;
+
+  /**
+   * \returns A shell matrix which applies the jacobian by finite
+   * differences of residuals, if \p jacobian_free is set, or by
+   * element-by-element products, if \p matrix_free is set, or \p NULL
+   * otherwise.
+   */
+  virtual ShellMatrix<Number> * get_jacobian_shell_matrix () libmesh_override;
+
+  /**
+   * Sets \p dest to (or, if \p add is true, increments \p dest by)
+   * the product of the constrained jacobian at the current solution
+   * with \p arg, without assembling a global matrix: each element
+   * jacobian is computed by the usual physics callbacks and applied
+   * to the local part of \p arg.
+   */
+  void jacobian_vector_mult (NumericVector<Number> & dest,
+                             const NumericVector<Number> & arg,
+                             bool add = false);
+
+  /**
+   * Sets \p dest to the diagonal of the constrained jacobian at the
+   * current solution, without assembling a global matrix.
+   */
+  void jacobian_diagonal (NumericVector<Number> & dest);
+
+  /**
+   * Sets \p dest to (or, if \p add is true, increments \p dest by)
+   * a finite difference approximation of the product of the
+   * constrained jacobian at the current solution with \p arg,
+   * (R(u + h arg) - R(u)) / h, from residual assemblies alone.
+   */
+  void jacobian_free_vector_mult (NumericVector<Number> & dest,
+                                  const NumericVector<Number> & arg,
+                                  bool add = false);
+
+  /**
+   * If \p jacobian_free is set and a "Preconditioner" matrix has been
+   * added, assembles the jacobian into it, using the physics object
+   * from \p attach_preconditioner_physics() if there is one.
+   */
+  virtual void assemble_preconditioner () libmesh_override;
+
+  /**
+   * Sets a physics object, e.g. with lower order or lumped terms,
+   * whose jacobian \p assemble_preconditioner() assembles in place of
+   * the system physics.  The object is not copied, and must outlive
+   * its use here; pass \p NULL to go back to the system physics.
+   */
+  void attach_preconditioner_physics (DifferentiablePhysics * physics_in);
+
   /**
    * Tells the FEMSystem to set the degree of freedom coefficients
    * which should correspond to mesh nodal coordinates.
@@ -201,6 +262,146 @@ public:
    */
   Real verify_analytic_jacobians;
 
+  /**
+   * If colored_assembly is true (it is false by default), the active
+   * local elements are greedily colored so that no two elements of
+   * the same color share a (constraint-expanded) degree of freedom.
+   * The elements of each color are assembled in parallel without
+   * taking the assembly lock, each thread keeping its element
+   * systems, which are then inserted into the global matrix and
+   * residual by the calling thread before the next color starts;
+   * the matrix and vector backends don't support concurrent
+   * insertion.  Elements which touch degrees of freedom owned by
+   * other processors, or which could not be given one of the
+   * available colors, are assembled and inserted under the lock.
+   *
+   * This only pays off with more than one thread, and costs the
+   * memory of one color's element systems.  The coloring is cached
+   * until the next reinit().
+   */
+  bool colored_assembly;
+
+  /**
+   * If overlap_ghost_communication is true (it is false by default),
+   * \p assembly() only starts the ghost update of
+   * \p current_local_solution (through \p System::begin_update(),
+   * bypassing any override of \p update()), assembles the elements
+   * whose degrees of freedom are all locally owned while the values
+   * from other processors are in flight, and then finishes it before
+   * assembling the remaining elements.  The split is cached until the
+   * next reinit(); with colored_assembly the colored elements serve
+   * as the interior set.
+   */
+  bool overlap_ghost_communication;
+
+  /**
+   * If assembly_batch_size is greater than one (it is one by
+   * default), each thread sorts its share of the elements by element
+   * type and p level before assembling them, so that consecutive
+   * elements share their reference element data, and then inserts
+   * the constrained element matrices and residuals into the global
+   * system assembly_batch_size elements at a time, taking the
+   * assembly lock once per batch rather than once per element.
+   */
+  unsigned int assembly_batch_size;
+
+  /**
+   * If blocked_assembly is true (it is false by default), the
+   * elements \p assembly() hands to the threads are stably sorted by
+   * subdomain, p level and element type first, so that each thread
+   * works through homogeneous blocks and its FEMContext rarely has
+   * to switch between the variables and FE types of different
+   * physics.  This applies to the colored and interior/boundary
+   * element sets as well.  The sorted list is cached until the next
+   * reinit().
+   */
+  bool blocked_assembly;
+
+  /**
+   * If matrix_free is true (it is false by default), solvers which
+   * support shell matrices, such as NewtonSolver, apply the jacobian
+   * through \p get_jacobian_shell_matrix() instead of assembling it,
+   * and only the residual is assembled into the system.  Element
+   * jacobians are recomputed on every product, trading compute for
+   * the memory and bandwidth of a global sparse matrix; a
+   * "Preconditioner" matrix, if one has been added, is still used
+   * to precondition the solve.
+   */
+  bool matrix_free;
+
+  /**
+   * If jacobian_free is true (it is false by default), solvers which
+   * support shell matrices apply the jacobian through
+   * \p get_jacobian_shell_matrix() by finite differences of residual
+   * assemblies, J v ~ (R(u + h v) - R(u)) / h, so that no element
+   * jacobians are computed during the linear solve at all.  R(u) is
+   * taken from the latest residual assembly when that was done at the
+   * current solution.  The jacobian is only assembled into the
+   * "Preconditioner" matrix, if one has been added, by
+   * \p assemble_preconditioner(); combined with
+   * DiffSolver::reuse_preconditioner, that happens only when the
+   * lagged preconditioner goes stale.  This takes precedence over
+   * \p matrix_free.
+   */
+  bool jacobian_free;
+
+  /**
+   * The size of the finite difference perturbation for
+   * \p jacobian_free products, relative to (1 + |u|) / |v|.  Defaults
+   * to the square root of the machine epsilon.
+   */
+  Real jacobian_free_epsilon;
+
+  /**
+   * If record_assembly_times is true (it is false by default), each
+   * \p assembly() measures the wall time spent reinitializing and
+   * computing the system of each active local element, before its
+   * constraints and its insertion into the global system, for
+   * \p assembly_cost_weights().
+   */
+  bool record_assembly_times;
+
+  /**
+   * If dg_face_assembly is true (it is false by default),
+   * \p assembly() does not ask each element for the side terms of
+   * its interior sides, but visits every interior face once, from
+   * the finer of its two active elements or, between elements on
+   * the same level, the lower numbered one.  \p build_context() then
+   * builds a DGFEMContext, which has its neighbor set and
+   * neighbor_side_fe_reinit() called before the side residual is
+   * requested, so the physics should fill in the neighbor residual
+   * and the element-neighbor, neighbor-element and neighbor-neighbor
+   * jacobian blocks along with the element ones.  Both elements'
+   * blocks are constrained and inserted as one system.  The faces
+   * are split among threads like elements; their side jacobians
+   * must be analytic, and jacobian products (\p matrix_free) do not
+   * include them.  The face list is cached until the next reinit().
+   */
+  bool dg_face_assembly;
+
+  /**
+   * Sets \p weights, on every processor, to the measured assembly cost
+   * of each active element, indexed by element id, for
+   * Partitioner::attach_weights().  By default each element weighs
+   * the average time of every timed assembly of the elements with its
+   * type, p level and subdomain; if \p per_element is true, elements
+   * timed in the latest assembly weigh their own time instead.
+   * Elements of a class which was never timed, e.g. one just created
+   * by refinement, weigh the average of all timed elements.
+   *
+   * The weights are scaled to average 100 per element, so that
+   * partitioners which round them to integers keep their ratios.
+   * Since they are indexed by id, they should be rebuilt whenever the
+   * mesh changes before the next partitioning.
+   */
+  void assembly_cost_weights (ErrorVector & weights,
+                              bool per_element = false) const;
+
+  /**
+   * Discards the assembly times recorded so far.
+   */
+  void clear_assembly_times ();
+
   /**
    * Syntax sugar to make numerical_jacobian() declaration easier.
    */
@@ -242,7 +443,123 @@ protected:
   virtual void init_data () libmesh_override;
 
 private:
+  /**
+   * Builds \p _element_colors and \p _uncolored_elements for
+   * colored_assembly.
+   */
+  void build_assembly_coloring ();
+
+  /**
+   * Builds \p _interior_elements and \p _boundary_elements for
+   * overlap_ghost_communication.
+   */
+  void build_interior_split ();
+
+  /**
+   * Builds \p _dg_faces for dg_face_assembly.
+   */
+  void build_dg_faces ();
+
+  /**
+   * Builds \p _blocked_elements for blocked_assembly.
+   */
+  void build_blocked_elements ();
+
   std::vector<Real> _numerical_jacobian_h_for_var;
+
+  /**
+   * The active local elements, sorted into groups whose
+   * (constraint-expanded) degrees of freedom are pairwise disjoint.
+   */
+  std::vector<std::vector<const Elem *> > _element_colors;
+
+  /**
+   * The active local elements which could not be colored and must be
+   * inserted under the assembly lock.
+   */
+  std::vector<const Elem *> _uncolored_elements;
+
+  /**
+   * Whether \p _element_colors is up to date.
+   */
+  bool _assembly_coloring_valid;
+
+  /**
+   * The active local elements whose (constraint-expanded) degrees of
+   * freedom are all owned by this processor, and the rest.
+   */
+  std::vector<const Elem *> _interior_elements;
+  std::vector<const Elem *> _boundary_elements;
+
+  /**
+   * Whether \p _interior_elements is up to date.
+   */
+  bool _interior_split_valid;
+
+  /**
+   * The interior faces of dg_face_assembly, as the element and side
+   * they are visited from, and whether they are up to date.
+   */
+  std::vector<std::pair<const Elem *, unsigned char> > _dg_faces;
+  bool _dg_faces_valid;
+
+  /**
+   * The active local elements sorted for blocked_assembly, and
+   * whether they are up to date.
+   */
+  std::vector<const Elem *> _blocked_elements;
+  bool _blocked_elements_valid;
+
+  /**
+   * The time of each active local element in the latest timed
+   * \p assembly(), indexed by element id, or negative for elements
+   * which weren't timed.  Discarded by reinit(), since the elements
+   * may have changed.
+   */
+  std::vector<double> _assembly_times;
+
+  /**
+   * The summed time, and the number, of the timed assemblies of the
+   * local elements of each type, p level and subdomain, packed into
+   * one key.  These outlive reinit(), so they can weigh new elements.
+   */
+  std::map<uint64_t, std::pair<double, unsigned int> > _assembly_class_times;
+
+  /**
+   * The shell matrix handed out by \p get_jacobian_shell_matrix().
+   */
+  UniquePtr<ShellMatrix<Number> > _jacobian_shell_matrix;
+
+  /**
+   * The shell matrix handed out by \p get_jacobian_shell_matrix() when
+   * \p jacobian_free is set.
+   */
+  UniquePtr<ShellMatrix<Number> > _jacobian_free_shell_matrix;
+
+  /**
+   * The residual at the current solution, for \p jacobian_free
+   * products, and whether it is up to date.
+   */
+  UniquePtr<NumericVector<Number> > _jacobian_free_residual;
+  bool _jacobian_free_residual_valid;
+
+  /**
+   * Whether the assembly in progress is a perturbed residual for a
+   * \p jacobian_free product.
+   */
+  bool _in_jacobian_free_product;
+
+  /**
+   * The physics used by \p assemble_preconditioner(), or \p NULL to
+   * use the system physics.
+   */
+  DifferentiablePhysics * _preconditioner_physics;
+
+  /**
+   * Helper for \p jacobian_vector_mult() and \p jacobian_diagonal().
+   */
+  void element_jacobian_products (NumericVector<Number> & dest,
+                                  const NumericVector<Number> * arg);
 };
 
 // --------------------------------------------------------------
@@ -109,6 +109,10 @@ public:
    * allocated vectors named \p solution_nnnn.  For access to these vectors,
    * see \p System. When calling this, the frequency range should
    * already be set.
+   *
+   * The same system matrix is refilled by \p solve_system for every
+   * frequency, so as long as that keeps its sparsity pattern the
+   * linear solver can reuse e.g. a symbolic factorization.
    */
   void solve (const unsigned int n_start,
               const unsigned int n_stop);
@@ -185,6 +189,17 @@ public:
   void (* solve_system) (EquationSystems & es,
                          const std::string & name);
 
+  /**
+   * When \p true, and the solutions are kept for each frequency,
+   * \p solve() starts the linear solver at each frequency from a
+   * linear extrapolation of the solutions at the two previous
+   * frequencies of the sweep, instead of from the solution at the
+   * previous frequency.  For closely spaced frequencies this can
+   * save many iterations; near resonances it may not.  Defaults to
+   * \p false.
+   */
+  bool extrapolate_initial_guess;
+
   /**
    * \returns The number of iterations and the final residual.
    */
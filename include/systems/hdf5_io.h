@@ -0,0 +1,126 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_HDF5_IO_H
+#define LIBMESH_HDF5_IO_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/parallel_object.h"
+
+// C++ includes
+#include <set>
+#include <string>
+
+namespace libMesh
+{
+
+// Forward declarations
+class EquationSystems;
+
+/**
+ * This class writes the mesh and the vectors of every system of an
+ * EquationSystems object to one HDF5 file, and reads the vectors
+ * back, all or only some of them.
+ *
+ * The file holds a "mesh" group, with the local nodes and active
+ * elements of every processor, and a "systems" group with a group
+ * for each system.  Each system group has the system type, its
+ * variable names and FE types, a "dof_objects" table giving the
+ * (kind, id, variable, component) of every dof, and a dataset for
+ * the solution and for each additional vector, in dof order.
+ * Datasets are chunked, and may be compressed with the shuffle and
+ * deflate filters.
+ *
+ * Each processor writes its own rows of each dataset.  With a
+ * parallel HDF5 library the writes are collective; otherwise
+ * processor 0 writes the rows of one processor at a time.  Readers
+ * take an even share of the rows and send each value on to the
+ * processor which owns its dof now, so the file can be read on any
+ * number of processors.
+ *
+ * This class does nothing unless libMesh was configured with HDF5.
+ */
+class HDF5IO : public ParallelObject
+{
+public:
+
+  /**
+   * Constructor for writing.
+   */
+  explicit
+  HDF5IO (const EquationSystems & es);
+
+  /**
+   * Constructor for reading.
+   */
+  explicit
+  HDF5IO (EquationSystems & es);
+
+  /**
+   * Writes the mesh and all systems which are not hidden to the file
+   * \p name.  Additional vectors are only written if \p
+   * write_additional_data is true.
+   */
+  void write (const std::string & name,
+              bool write_additional_data = true);
+
+  /**
+   * Reads the vectors of the systems named in \p system_names, or of
+   * all systems in the file if it is NULL, from the file \p name.
+   * Only the vectors named in \p vector_names are read, or all of
+   * them if it is NULL; the solution is called "solution".
+   *
+   * Systems missing from our EquationSystems are skipped, unless it
+   * has no systems at all, in which case they are all created from
+   * the file and initialized.  Missing additional vectors are added.
+   */
+  void read (const std::string & name,
+             const std::set<std::string> * system_names = libmesh_nullptr,
+             const std::set<std::string> * vector_names = libmesh_nullptr);
+
+  /**
+   * Sets the number of rows in each chunk of each dataset.
+   */
+  void set_chunk_size (unsigned int rows);
+
+  /**
+   * Sets the deflate compression level, from 0 (no compression, the
+   * default) to 9.
+   */
+  void set_compression_level (unsigned int level);
+
+private:
+
+  const EquationSystems & _es;
+
+  /**
+   * Only set when reading.
+   */
+  EquationSystems * _es_in;
+
+  unsigned int _chunk_size;
+
+  unsigned int _compression_level;
+};
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_HDF5_IO_H
@@ -25,6 +25,8 @@
 
 // C++ includes
 #include <cstddef>
+#include <set>
+#include <vector>
 
 namespace libMesh
 {
@@ -32,6 +34,7 @@ namespace libMesh
 // Forward declarations
 template <typename T> class LinearSolver;
 template <typename T> class SparseMatrix;
+template <typename T> class ShellMatrix;
 
 /**
  * This class provides a specific system class.  It aims
@@ -154,6 +157,24 @@ public:
                          bool /* apply_no_constraints */ = false)
   { libmesh_not_implemented(); }
 
+  /**
+   * \returns A shell matrix applying the jacobian at the current
+   * solution, which solvers should use in place of the assembled
+   * \p matrix, or \p NULL if linear systems should be solved with
+   * the assembled matrix as usual.  The default implementation
+   * returns \p NULL.
+   */
+  virtual ShellMatrix<Number> * get_jacobian_shell_matrix ()
+  { return libmesh_nullptr; }
+
+  /**
+   * Assembles the "Preconditioner" matrix, for solvers which apply
+   * the jacobian through \p get_jacobian_shell_matrix() and so never
+   * assemble \p matrix.  The default implementation does nothing,
+   * leaving any preconditioner matrix to the user.
+   */
+  virtual void assemble_preconditioner () {}
+
   /**
    * Residual parameter derivative function.
    *
@@ -169,10 +190,11 @@ public:
 
   /**
    * Assembles & solves the linear system(s) (dR/du)*u_p = -dR/dp, for
-   * those parameters contained within \p parameters.
+   * those parameters contained within \p parameters.  The systems
+   * are solved together, sharing a single preconditioner setup.
    *
-   * \returns A pair with the total number of linear iterations
-   * performed and the (sum of the) final residual norms
+   * \returns A pair with the largest number of linear iterations
+   * and the largest final residual norm of any of the solves
    */
   virtual std::pair<unsigned int, Real>
   sensitivity_solve (const ParameterVector & parameters) libmesh_override;
@@ -193,10 +215,12 @@ public:
    * Assembles & solves the linear system (dR/du)^T*z = dq/du, for
    * those quantities of interest q specified by \p qoi_indices.
    *
-   * Leave \p qoi_indices empty to solve all adjoint problems.
+   * Leave \p qoi_indices empty to solve all adjoint problems.  The
+   * adjoint problems are solved together, sharing a single
+   * preconditioner setup.
    *
-   * \returns A pair with the total number of linear iterations
-   * performed and the (sum of the) final residual norms
+   * \returns A pair with the largest number of linear iterations
+   * and the largest final residual norm of any of the solves
    */
   virtual std::pair<unsigned int, Real>
   adjoint_solve (const QoISet & qoi_indices = QoISet()) libmesh_override;
@@ -350,6 +374,18 @@ public:
    */
   bool zero_out_matrix_and_rhs;
 
+  /**
+   * Optionally declares where the physics depend on each of the
+   * parameters passed to \p qoi_parameter_hessian(): entry \p k
+   * holds the ids of the subdomains whose residual and QoI
+   * contributions depend on parameter \p k.  The mixed partial
+   * derivatives of the residual and QoI with respect to two
+   * parameters with disjoint subdomain sets vanish, so they are not
+   * finite differenced.  Empty by default, in which case every
+   * parameter is assumed to affect every element.
+   */
+  std::vector<std::set<subdomain_id_type> > parameter_subdomains;
+
 
 protected:
 
@@ -0,0 +1,120 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_INCREMENTAL_CHECKPOINT_H
+#define LIBMESH_INCREMENTAL_CHECKPOINT_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/equation_systems.h"
+#include "libmesh/parallel_object.h"
+
+// C++ includes
+#include <string>
+
+namespace libMesh
+{
+
+/**
+ * This class writes checkpoints of an EquationSystems object which
+ * only contain the mesh when it has changed since the last
+ * checkpoint, as told by MeshBase::revision().
+ *
+ * Every checkpoint is a small text "manifest" file, base_<step>.ckpt,
+ * naming the CheckpointIO file holding its mesh and the
+ * EquationSystems file holding its vectors, base_<step>.xda (or
+ * .xdr).  The mesh is written to base_mesh_<step>.cpa (or .cpr) at
+ * the first checkpoint and after each change; checkpoints in between
+ * refer to the last one written.  The manifest is written last, so a
+ * checkpoint interrupted part way leaves the earlier ones usable.
+ *
+ * File names are stored as they were opened, so checkpoints with a
+ * relative base name have to be read from the same working
+ * directory.  Mesh files which are still referred to must not be
+ * deleted.  Code which moves nodes or otherwise changes the mesh
+ * without calling MeshBase::prepare_for_use() must call
+ * MeshBase::mark_modified().
+ */
+class IncrementalCheckpoint : public ParallelObject
+{
+public:
+
+  /**
+   * Constructor.  The files are named after \p base_name, which may
+   * include a directory.
+   */
+  IncrementalCheckpoint (EquationSystems & es,
+                         const std::string & base_name);
+
+  /**
+   * Whether to write binary (.cpr and .xdr) files rather than ASCII
+   * (.cpa and .xda) files.  Defaults to false.
+   */
+  bool   binary() const { return _binary; }
+  bool & binary()       { return _binary; }
+
+  /**
+   * Whether to checkpoint the additional vectors of each system as
+   * well as its solution.  Defaults to true.
+   */
+  bool   write_additional_data() const { return _write_additional_data; }
+  bool & write_additional_data()       { return _write_additional_data; }
+
+  /**
+   * Writes the checkpoint for time step \p step, and the mesh too if
+   * it has changed since the last checkpoint.
+   *
+   * \returns The name of the manifest file.
+   */
+  std::string write (unsigned int step);
+
+  /**
+   * Reads the checkpoint with the manifest \p name.  The mesh is
+   * cleared and read, unless it is the mesh written or read last by
+   * this object and has not changed since.  Then the systems are
+   * read with \p read_flags; without \p READ_HEADER, they have to
+   * exist already.
+   */
+  void read (const std::string & name,
+             unsigned int read_flags = (EquationSystems::READ_HEADER |
+                                        EquationSystems::READ_DATA |
+                                        EquationSystems::READ_ADDITIONAL_DATA));
+
+private:
+
+  EquationSystems & _es;
+
+  std::string _base_name;
+
+  bool _binary;
+
+  bool _write_additional_data;
+
+  /**
+   * The mesh file written or read last, and the mesh revision at the
+   * time.  The name is empty if there is none.
+   */
+  std::string _mesh_file;
+  unsigned int _mesh_revision;
+};
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_INCREMENTAL_CHECKPOINT_H
@@ -25,6 +25,7 @@
 
 // C++ includes
 #include <cstddef>
+#include <deque>
 
 namespace libMesh
 {
@@ -110,6 +111,14 @@ public:
   virtual void restrict_solve_to (const SystemSubset * subset,
                                   const SubsetSolveMode subset_solve_mode=SUBSET_ZERO) libmesh_override;
 
+  /**
+   * \returns The subset which solves are restricted to, or \p NULL
+   * if there is none.  Assembly functions can use its \p
+   * includes_elem() to skip the elements which do not matter for the
+   * restricted solve.
+   */
+  const SystemSubset * get_subset () const { return _subset; }
+
   /**
    * Assembles & solves the linear system A*x=b.
    */
@@ -183,8 +192,39 @@ public:
    */
   ShellMatrix<Number> * get_shell_matrix() { return _shell_matrix; }
 
+  /**
+   * The number of previous solutions \p solve() keeps between calls.
+   * If nonzero, each solve starts from the combination of the
+   * current solution and the kept solutions which minimizes the
+   * residual of the new system.  Since that span contains e.g. the
+   * linear extrapolation of the last two solutions, this typically
+   * saves many iterations when the matrix and right hand side change
+   * slowly, as in transient problems, at the cost of that many
+   * additional vectors and matrix-vector products per solve.  The
+   * kept solutions are discarded on \p reinit().  Defaults to 0.
+   */
+  unsigned int n_recycled_solutions;
+
 protected:
 
+  /**
+   * Replaces \p solution by the combination of itself and the
+   * previous solutions which minimizes the residual of the current
+   * system.
+   */
+  void recycled_initial_guess ();
+
+  /**
+   * Remembers the current solution for \p recycled_initial_guess(),
+   * dropping the oldest one beyond \p n_recycled_solutions.
+   */
+  void store_recycled_solution ();
+
+  /**
+   * Deletes all the previous solutions.
+   */
+  void clear_recycled_solutions ();
+
   /**
    * The number of linear iterations required to solve the linear
    * system Ax=b.
@@ -211,6 +251,12 @@ protected:
    * what happens with the dofs outside the subset.
    */
   SubsetSolveMode _subset_solve_mode;
+
+  /**
+   * The previous solutions kept for \p recycled_initial_guess(),
+   * most recent first.
+   */
+  std::deque<NumericVector<Number> *> _recycled_solutions;
 };
 
 } // namespace libMesh
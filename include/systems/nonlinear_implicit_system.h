@@ -87,6 +87,29 @@ public:
     virtual void residual (const NumericVector<Number> & X,
                            NumericVector<Number> & R,
                            sys_type & S) = 0;
+
+    /**
+     * Residual objects which return \p true here let solvers which
+     * support it, such as PetscNonlinearSolver, overlap the ghost
+     * update of the solution with assembly: \p residual_interior()
+     * is called while only the locally owned entries of \p X are
+     * valid, and should add the contributions of the interior
+     * elements of System::split_local_elements(), then
+     * \p residual_boundary() is called for the rest once the update
+     * has finished.  Systems with constraints are still evaluated
+     * through \p residual().
+     */
+    virtual bool overlap_ghost_update () const { return false; }
+
+    virtual void residual_interior (const NumericVector<Number> & /*X*/,
+                                    NumericVector<Number> & /*R*/,
+                                    sys_type & /*S*/)
+    { libmesh_not_implemented(); }
+
+    virtual void residual_boundary (const NumericVector<Number> & /*X*/,
+                                    NumericVector<Number> & /*R*/,
+                                    sys_type & /*S*/)
+    { libmesh_not_implemented(); }
   };
 
 
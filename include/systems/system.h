@@ -53,6 +53,7 @@ template <typename Output> class FunctionBase;
 class Parameters;
 class ParameterVector;
 class Point;
+class Elem;
 class SensitivityData;
 template <typename T> class NumericVector;
 template <typename T> class VectorValue;
@@ -260,6 +261,28 @@ public:
    */
   virtual void update ();
 
+  /**
+   * Starts the same update as \p System::update(), but may return
+   * before the values owned by other processors have arrived; only
+   * the locally owned entries of \p current_local_solution may be
+   * read until the matching \p end_update().
+   */
+  void begin_update ();
+
+  /**
+   * Completes an update started by \p begin_update().
+   */
+  void end_update ();
+
+  /**
+   * Sorts the active local elements into \p interior, those whose
+   * (constraint-expanded) degrees of freedom are all owned by this
+   * processor, and \p boundary, the rest.  Interior elements can be
+   * assembled between \p begin_update() and \p end_update().
+   */
+  void split_local_elements (std::vector<const Elem *> & interior,
+                             std::vector<const Elem *> & boundary) const;
+
   /**
    * Prepares \p matrix and \p _dof_map for matrix assembly.
    * Does not actually assemble anything.  For matrix assembly,
@@ -1297,6 +1320,27 @@ public:
                            const bool read_additional_data)
   { read_parallel_data<Number>(io, read_additional_data); }
 
+  /**
+   * Reads additional data, namely vectors, for this System from files
+   * written by write_chunked_data(), on any number of processors.
+   * This processor reads the chunk files in \p ios, which may be
+   * none, and every value is sent on to the processor which owns its
+   * DofObject now, so the files can be read with a different
+   * partitioning, or number of processors, than they were written
+   * with.  This method may safely be called on a distributed-memory
+   * mesh.
+   */
+  template <typename InValType>
+  void read_chunked_data (const std::vector<Xdr *> & ios,
+                          const bool read_additional_data);
+
+  /**
+   * Non-templated version for backward compatibility.
+   */
+  void read_chunked_data (const std::vector<Xdr *> & ios,
+                          const bool read_additional_data)
+  { read_chunked_data<Number>(ios, read_additional_data); }
+
   /**
    * Writes the basic data header for this System.
    */
@@ -1328,6 +1372,19 @@ public:
   void write_parallel_data (Xdr & io,
                             const bool write_additional_data) const;
 
+  /**
+   * Writes additional data, namely vectors, for this System to a
+   * chunk of its own for each processor.  Each chunk starts with an
+   * index table listing, for every variable, the ids of the local
+   * nodes and elements with dofs of that variable and how many, and
+   * follows it with the values of each vector in the same order.
+   * Since the values are tied to DofObject ids and not to dof
+   * indices, the chunks can be read back by read_chunked_data() on
+   * any number of processors.
+   */
+  void write_chunked_data (Xdr & io,
+                           const bool write_additional_data) const;
+
   /**
    * \returns A string containing information about the
    * system.
@@ -1654,6 +1711,12 @@ public:
    */
   bool & hide_output() { return _hide_output; }
 
+  /**
+   * \returns \p true if \p EquationSystems::write will ignore this
+   * system.
+   */
+  bool hide_output() const { return _hide_output; }
+
 protected:
 
   /**
@@ -1685,6 +1748,24 @@ protected:
                        NumericVector<Number> &,
                        int is_adjoint = -1) const;
 
+  /**
+   * Projects each of the vectors \p old_vectors defined on the old
+   * mesh onto the matching entry of \p new_vectors on the new mesh,
+   * constrained as requested by the matching entry of \p is_adjoint.
+   * All the vectors are projected in a single pass over the
+   * elements, which shares the work of finding and evaluating the
+   * old elements between them.
+   */
+  void project_vectors (const std::vector<const NumericVector<Number> *> & old_vectors,
+                        const std::vector<NumericVector<Number> *> & new_vectors,
+                        const std::vector<int> & is_adjoint) const;
+
+  /**
+   * \returns The sorted, unique list of old dof indices which this
+   * processor needs to project a vector onto the current mesh.
+   */
+  const std::vector<dof_id_type> & projection_send_list () const;
+
 private:
   /**
    * This isn't a copyable object, so let's make sure nobody tries.
@@ -1985,6 +2066,17 @@ private:
    * \p true, then \p EquationSystems::write will ignore this system.
    */
   bool _hide_output;
+
+  /**
+   * Sorted, unique list of old dof indices needed to localize a
+   * vector for projection onto the current mesh.  While
+   * \p _reuse_projection_send_list is \p true (i.e. during
+   * \p restrict_vectors()) it is built once and shared by every
+   * projected vector.
+   */
+  mutable std::vector<dof_id_type> _projection_send_list;
+  mutable bool _projection_send_list_built;
+  bool _reuse_projection_send_list;
 };
 
 
@@ -31,6 +31,7 @@ namespace libMesh
 
 // Forward Declarations
 class System;
+class Elem;
 
 /**
  * This is a base class for classes which represent subsets of the
@@ -62,6 +63,14 @@ public:
    */
   virtual const std::vector<unsigned int> & dof_ids () const = 0;
 
+  /**
+   * \returns \p true if assembly on \p elem is needed for a solve
+   * restricted to this subset.  Assembly functions can skip the
+   * other elements.  The default is conservative and includes every
+   * element.
+   */
+  virtual bool includes_elem (const Elem & elem) const;
+
   /**
    * \returns The \p System to which we belong.
    */
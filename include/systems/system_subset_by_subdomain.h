@@ -154,6 +154,15 @@ public:
    */
   virtual const std::vector<unsigned int> & dof_ids () const libmesh_override;
 
+  /**
+   * \returns \p true if \p elem is in one of the selected subdomains.
+   *
+   * \note Elements of other subdomains may still share dofs with the
+   * subset, on the interfaces between subdomains.  An assembly which
+   * skips them leaves their contributions to those dofs out.
+   */
+  virtual bool includes_elem (const Elem & elem) const libmesh_override;
+
   /**
    * Initializes the class.  Will be called by the constructors.  Can
    * also be called manually to update the subset.  This is required
@@ -193,6 +202,11 @@ protected:
    */
   std::vector<unsigned int> _dof_ids;
 
+  /**
+   * The ids of the selected subdomains, out of those in the mesh.
+   */
+  std::set<subdomain_id_type> _subdomain_ids;
+
 }; // class SystemSubset
 
 } // namespace libMesh
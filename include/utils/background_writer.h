@@ -0,0 +1,136 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_BACKGROUND_WRITER_H
+#define LIBMESH_BACKGROUND_WRITER_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <deque>
+#include <string>
+
+#ifdef LIBMESH_HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
+namespace libMesh
+{
+
+/**
+ * A dedicated thread which runs queued jobs one at a time, in the
+ * order they were queued, so that I/O classes can write files while
+ * the caller carries on computing.
+ *
+ * At most \p max_queued jobs wait at any time.  Queueing another one
+ * blocks until the thread has caught up, so a slow file system
+ * throttles the caller rather than piling up copies of its data.
+ *
+ * An exception thrown by a job is reported by the next call to \p
+ * push() or \p wait().  Without pthreads jobs simply run when they
+ * are queued.
+ */
+class BackgroundWriter
+{
+public:
+
+  /**
+   * A unit of work.  Jobs own copies of the data they write.
+   */
+  class Job
+  {
+  public:
+    virtual ~Job () {}
+
+    virtual void run () = 0;
+  };
+
+  explicit
+  BackgroundWriter (unsigned int max_queued = 2);
+
+  /**
+   * Runs any queued jobs, then stops the thread.
+   */
+  ~BackgroundWriter ();
+
+  /**
+   * Queues \p job, which is deleted once it has run.
+   */
+  void push (Job * job);
+
+  /**
+   * Queues \p job, waiting first until fewer than \p max_queued jobs
+   * are queued.  Callers which share one writer can keep their own
+   * limits this way.
+   */
+  void push (Job * job, unsigned int max_queued);
+
+  /**
+   * Blocks until every queued job has run.
+   */
+  void wait ();
+
+  unsigned int max_queued () const { return _max_queued; }
+
+private:
+
+  /**
+   * Reports, and forgets, the error of a failed job.
+   */
+  void check_error ();
+
+  /**
+   * Runs \p job, catching any exception it throws.
+   */
+  void run_job (Job * job);
+
+  const unsigned int _max_queued;
+
+  /**
+   * The message of the first job which failed since the last check.
+   */
+  std::string _error;
+
+#ifdef LIBMESH_HAVE_PTHREAD
+  static void * thread_main (void * args);
+
+  std::deque<Job *> _queue;
+
+  /**
+   * Whether the thread is running a job it already took off the queue
+   */
+  bool _busy;
+
+  bool _shutdown;
+
+  pthread_t _thread;
+  pthread_mutex_t _mutex;
+
+  /**
+   * Signalled when a job is queued, and when a job finishes.
+   */
+  pthread_cond_t _queued_cond;
+  pthread_cond_t _done_cond;
+#endif
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_BACKGROUND_WRITER_H
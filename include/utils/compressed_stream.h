@@ -0,0 +1,186 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_COMPRESSED_STREAM_H
+#define LIBMESH_COMPRESSED_STREAM_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+#if defined(LIBMESH_HAVE_LIBBZ2) || defined(LIBMESH_HAVE_LIBLZMA)
+
+// C++ includes
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * A std::streambuf which compresses data on its way to, or
+ * decompresses data on its way from, a .bz2 or .xz file, in the
+ * style of the gzstream classes used for .gz files.  A buffer only
+ * reads or only writes, depending on how it was opened.
+ *
+ * When libMesh runs with more than one thread, and liblzma is recent
+ * enough, .xz files are compressed with that many threads.
+ */
+class CompressedStreamBuf : public std::streambuf
+{
+public:
+
+  /**
+   * The supported compression formats.
+   */
+  enum Format { BZIP2, XZ };
+
+  CompressedStreamBuf ();
+
+  ~CompressedStreamBuf ();
+
+  /**
+   * Opens the file \p name for reading or writing, as \p mode
+   * specifies, compressed in \p format.
+   *
+   * \returns \p this on success, \p NULL on failure.
+   */
+  CompressedStreamBuf * open (const char * name,
+                              std::ios_base::openmode mode,
+                              Format format);
+
+  /**
+   * Finishes the compressed stream, if writing, and closes the file.
+   *
+   * \returns \p this on success, \p NULL on failure.
+   */
+  CompressedStreamBuf * close ();
+
+  bool is_open () const { return _file != libmesh_nullptr; }
+
+  /**
+   * \returns The format implied by the extension of \p name, and
+   * sets \p supported to whether this build can stream it.
+   */
+  static Format format_of (const std::string & name, bool & supported);
+
+protected:
+
+  virtual int_type underflow () libmesh_override;
+
+  virtual int_type overflow (int_type c) libmesh_override;
+
+  virtual int sync () libmesh_override;
+
+private:
+
+  /**
+   * Fills \p _buffer with decompressed data.
+   *
+   * \returns The number of characters read.
+   */
+  std::size_t decompress ();
+
+  /**
+   * Compresses the contents of the put area, and finishes the
+   * compressed stream if \p finish is true.
+   *
+   * \returns \p false on failure.
+   */
+  bool compress (bool finish);
+
+  /**
+   * The codec state, which is specific to the compression library.
+   */
+  struct Codec;
+  Codec * _codec;
+
+  std::FILE * _file;
+  Format _format;
+  bool _writing;
+
+  /**
+   * Uncompressed data, and compressed data on its way to or from
+   * \p _file.
+   */
+  std::vector<char> _buffer;
+  std::vector<char> _compressed;
+};
+
+
+
+/**
+ * An input stream which reads a .bz2 or .xz file through a
+ * CompressedStreamBuf.
+ */
+class CompressedIStream : public std::istream
+{
+public:
+  CompressedIStream () : std::istream(&_buf) {}
+
+  void open (const char * name, CompressedStreamBuf::Format format)
+  {
+    if (!_buf.open(name, std::ios_base::in, format))
+      this->setstate(std::ios_base::failbit);
+  }
+
+  void close ()
+  {
+    if (!_buf.close())
+      this->setstate(std::ios_base::failbit);
+  }
+
+private:
+  CompressedStreamBuf _buf;
+};
+
+
+
+/**
+ * An output stream which writes a .bz2 or .xz file through a
+ * CompressedStreamBuf.  The file is only complete once the stream
+ * is closed or destroyed.
+ */
+class CompressedOStream : public std::ostream
+{
+public:
+  CompressedOStream () : std::ostream(&_buf) {}
+
+  void open (const char * name, CompressedStreamBuf::Format format)
+  {
+    if (!_buf.open(name, std::ios_base::out, format))
+      this->setstate(std::ios_base::failbit);
+  }
+
+  void close ()
+  {
+    if (!_buf.close())
+      this->setstate(std::ios_base::failbit);
+  }
+
+private:
+  CompressedStreamBuf _buf;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_HAVE_LIBBZ2 || LIBMESH_HAVE_LIBLZMA
+
+#endif // LIBMESH_COMPRESSED_STREAM_H
@@ -0,0 +1,151 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_CONCURRENT_LOCATION_MAP_H
+#define LIBMESH_CONCURRENT_LOCATION_MAP_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/point.h"
+
+// C++ Includes
+#include <atomic>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward Declarations
+class MeshBase;
+
+/**
+ * A variant of \p LocationMap which many threads can fill and search
+ * at the same time, e.g. from within \p Threads::parallel_for().
+ *
+ * Objects are binned by their location, as in \p LocationMap, and
+ * kept in an open addressing table with linear probing, keyed on
+ * their bins.  Each slot is claimed with a compare-and-swap on its
+ * state, so no locks are taken.  The table does not grow: \p init()
+ * makes room for everything in the mesh plus a number of additional
+ * objects.
+ *
+ * As in \p LocationMap, several objects may share a location.  A
+ * thread which calls \p find() before \p insert() can therefore not
+ * be sure that no other thread inserts an object at the same place
+ * in between; deduplicating concurrently built objects by location
+ * needs a second, serial pass.
+ */
+template <typename T>
+class ConcurrentLocationMap
+{
+public:
+  /**
+   * Constructor.  The map can hold nothing until \p init() is called.
+   */
+  ConcurrentLocationMap ();
+
+  /**
+   * Caches a bounding box of the \p mesh, makes room for all its
+   * nodes or active elements plus \p n_additional objects inserted
+   * later, and inserts those of the mesh.  Must be run on all
+   * processors at once for a distributed mesh.  Not thread safe.
+   */
+  void init (MeshBase & mesh,
+             std::size_t n_additional = 0);
+
+  /**
+   * Removes everything from the map, keeping the room reserved and
+   * the bounding box.  Not thread safe.
+   */
+  void clear ();
+
+  /**
+   * Inserts \p t.  Thread safe.
+   */
+  void insert (T & t);
+
+  /**
+   * Inserts all of \p objects, in parallel.
+   */
+  void insert (const std::vector<T *> & objects);
+
+  /**
+   * \returns An object within \p tol of \p p, or NULL.  Thread safe,
+   * also while other threads insert.
+   */
+  T * find (const Point & p,
+            const Real tol = TOLERANCE) const;
+
+  Point point_of (const T &) const;
+
+  /**
+   * \returns The number of objects in the map.
+   */
+  std::size_t size () const { return _size; }
+
+  bool empty () const { return this->size() == 0; }
+
+protected:
+  /**
+   * \returns The bin of \p p, numbered as in \p LocationMap.
+   */
+  unsigned int key (const Point & p) const;
+
+  /**
+   * \returns The object within \p tol of \p p in bin \p pointkey, or
+   * NULL.
+   */
+  T * find_in_bin (unsigned int pointkey,
+                   const Point & p,
+                   const Real tol) const;
+
+  void fill (MeshBase &);
+
+private:
+  /**
+   * \returns The slot at which probing for bin \p pointkey starts.
+   */
+  std::size_t home_slot (unsigned int pointkey) const;
+
+  /**
+   * States of a slot.  A slot is \p BUSY while the thread which
+   * claimed it writes its key and value.
+   */
+  enum SlotState { EMPTY = 0, BUSY = 1, FULL = 2 };
+
+  std::vector<std::atomic<unsigned char> > _states;
+  std::vector<unsigned int> _keys;
+  std::vector<T *> _values;
+
+  /**
+   * The number of slots minus one; the number of slots is a power of
+   * two.
+   */
+  std::size_t _mask;
+
+  std::atomic<std::size_t> _size;
+
+  std::vector<Real> _lower_bound;
+  std::vector<Real> _upper_bound;
+};
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_CONCURRENT_LOCATION_MAP_H
@@ -0,0 +1,169 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_CONCURRENT_TOPOLOGY_MAP_H
+#define LIBMESH_CONCURRENT_TOPOLOGY_MAP_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/id_types.h"
+
+// C++ Includes
+#include <atomic>
+#include <utility>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward Declarations
+class MeshBase;
+class Node;
+
+/**
+ * A variant of \p TopologyMap which many threads can fill and search
+ * at the same time, e.g. from within \p Threads::parallel_for().
+ *
+ * The key is a pair of node ids for two nodes bracketing a node,
+ * sorted lowest id first, and the value is the id of the node.  Keys
+ * live in an open addressing table with linear probing; each slot is
+ * claimed with a compare-and-swap on its state, so no locks are
+ * taken.  The table does not grow: \p reserve() it for all the keys
+ * before inserting from several threads.
+ *
+ * The first value inserted for a key wins, so threads which build
+ * the same node concurrently can use the value \p insert() returns
+ * to agree on a single one.
+ *
+ * \p init() and \p add_node() provide the interface of \p
+ * TopologyMap, for use by \p MeshRefinement: the map of an existing
+ * refinement hierarchy is filled in parallel, and the serial \p
+ * add_node() grows the table as needed.
+ */
+class ConcurrentTopologyMap
+{
+public:
+  /**
+   * Constructor.  The map can hold no keys until \p reserve() is
+   * called.
+   */
+  ConcurrentTopologyMap ();
+
+  /**
+   * Clears the map and fills it with the child nodes of every parent
+   * element of \p mesh, working out their bracketing nodes in
+   * parallel.  Must be run on all processors at once for a
+   * distributed mesh.  Not thread safe.
+   */
+  void init (const MeshBase & mesh);
+
+  /**
+   * Clears the map and makes room for \p n_keys keys.  Not thread
+   * safe.
+   */
+  void reserve (std::size_t n_keys);
+
+  /**
+   * Removes all keys, keeping the room reserved.  Not thread safe.
+   */
+  void clear ();
+
+  /**
+   * Maps the pair of \p bracket_node1 and \p bracket_node2 to \p
+   * node_id, unless it already has a value.  Thread safe.
+   *
+   * \returns The value now stored for the pair.
+   */
+  dof_id_type insert (dof_id_type bracket_node1,
+                      dof_id_type bracket_node2,
+                      dof_id_type node_id);
+
+  /**
+   * Inserts \p node_ids[i] for the pair \p bracketing_nodes[i] of
+   * every \p i, in parallel, and returns the values stored for them
+   * in \p stored_ids.
+   */
+  void insert (const std::vector<std::pair<dof_id_type, dof_id_type> > & bracketing_nodes,
+               const std::vector<dof_id_type> & node_ids,
+               std::vector<dof_id_type> & stored_ids);
+
+  /**
+   * Maps each pair of \p bracketing_nodes to \p mid_node, making
+   * room first if necessary.  Not thread safe.
+   */
+  void add_node (const Node & mid_node,
+                 const std::vector<std::pair<dof_id_type, dof_id_type> > & bracketing_nodes);
+
+  /**
+   * \returns The value stored for the pair of \p bracket_node1 and \p
+   * bracket_node2, or \p DofObject::invalid_id.  Thread safe, also
+   * while other threads insert.
+   */
+  dof_id_type find (dof_id_type bracket_node1,
+                    dof_id_type bracket_node2) const;
+
+  /**
+   * \returns The value stored for any of the \p bracketing_nodes, or
+   * \p DofObject::invalid_id.
+   */
+  dof_id_type find (const std::vector<std::pair<dof_id_type, dof_id_type> > & bracketing_nodes) const;
+
+  /**
+   * \returns The number of keys in the map.
+   */
+  std::size_t size () const { return _size; }
+
+  bool empty () const { return this->size() == 0; }
+
+private:
+  /**
+   * Doubles the room in the table, keeping its keys.  Not thread
+   * safe.
+   */
+  void grow ();
+
+  /**
+   * \returns The slot at which probing for a key starts.
+   */
+  std::size_t home_slot (dof_id_type lower_id,
+                         dof_id_type upper_id) const;
+
+  /**
+   * States of a slot.  A slot is \p BUSY while the thread which
+   * claimed it writes its key and value.
+   */
+  enum SlotState { EMPTY = 0, BUSY = 1, FULL = 2 };
+
+  std::vector<std::atomic<unsigned char> > _states;
+  std::vector<std::pair<dof_id_type, dof_id_type> > _keys;
+  std::vector<dof_id_type> _values;
+
+  /**
+   * The number of slots minus one; the number of slots is a power of
+   * two.
+   */
+  std::size_t _mask;
+
+  std::atomic<std::size_t> _size;
+};
+
+} // namespace libMesh
+
+
+#endif // LIBMESH_CONCURRENT_TOPOLOGY_MAP_H
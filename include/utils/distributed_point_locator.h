@@ -0,0 +1,159 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_DISTRIBUTED_POINT_LOCATOR_H
+#define LIBMESH_DISTRIBUTED_POINT_LOCATOR_H
+
+// Local Includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/auto_ptr.h"
+#include "libmesh/bounding_box.h"
+#include "libmesh/id_types.h"
+#include "libmesh/parallel_object.h"
+#include "libmesh/point_locator_base.h"
+
+// C++ includes
+#include <set>
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward Declarations
+class MeshBase;
+template <typename T> class DenseVector;
+template <typename Output> class FunctionBase;
+
+/**
+ * This class locates points in a mesh which may be distributed, on
+ * whichever processor owns the element containing them, so that
+ * nobody needs to hold the whole mesh.
+ *
+ * \p init() builds a locator for the local elements and gathers the
+ * bounding box of the local elements of every processor, as \p
+ * MeshTools::create_local_bounding_box() gives them.  Each batch of
+ * queries is then sent to the processors whose boxes hold the points,
+ * located there, and the results sent back.  A point in elements of
+ * several processors is given to the lowest of them.
+ *
+ * All methods other than the accessors are collective.
+ */
+class DistributedPointLocator : public ParallelObject
+{
+public:
+  /**
+   * Constructor.  Call \p init() before locating points.
+   */
+  explicit
+  DistributedPointLocator (const MeshBase & mesh);
+
+  /**
+   * Destructor.
+   */
+  ~DistributedPointLocator ();
+
+  /**
+   * Builds the local locator and gathers the processor bounding
+   * boxes.  Must be called again after the mesh changes.
+   */
+  void init ();
+
+  /**
+   * Releases the local locator and the processor bounding boxes.
+   */
+  void clear ();
+
+  /**
+   * \returns \p true if \p init() has been called since the last
+   * \p clear().
+   */
+  bool initialized () const
+  { return _local_locator.get() != libmesh_nullptr; }
+
+  /**
+   * \returns The bounding box of the local elements of processor \p
+   * pid.
+   */
+  const BoundingBox & processor_bounding_box (processor_id_type pid) const;
+
+  /**
+   * Sets a tolerance for the local searches, as \p
+   * PointLocatorBase::set_close_to_point_tol() does.  Processor
+   * bounding boxes are padded by the same fraction of their
+   * diagonals.
+   */
+  void set_close_to_point_tol (Real close_to_point_tol);
+
+  /**
+   * Locates the local \p points of every processor.  Afterwards \p
+   * owners[i] is the processor owning the element containing
+   * points[i] and \p elem_ids[i] is its id, or both are invalid if
+   * no element, optionally restricted to the \p allowed_subdomains,
+   * contains the point.
+   */
+  void locate_points (const std::vector<Point> & points,
+                      std::vector<processor_id_type> & owners,
+                      std::vector<dof_id_type> & elem_ids,
+                      const std::set<subdomain_id_type> * allowed_subdomains = libmesh_nullptr) const;
+
+  /**
+   * Evaluates \p f at the local \p points of every processor, on the
+   * processors which own the points, and returns the results in \p
+   * values.  Points in no element get an empty result.
+   *
+   * \p f is only called for points in local elements, so a \p
+   * MeshFunction built on a parallel or ghosted vector can be
+   * evaluated at points anywhere in a distributed mesh.
+   */
+  void evaluate (const std::vector<Point> & points,
+                 FunctionBase<Number> & f,
+                 std::vector<DenseVector<Number> > & values,
+                 Real time = 0.,
+                 const std::set<subdomain_id_type> * allowed_subdomains = libmesh_nullptr) const;
+
+private:
+  /**
+   * The mesh we locate points in.
+   */
+  const MeshBase & _mesh;
+
+  /**
+   * A locator for the local active elements.
+   */
+  UniquePtr<PointLocatorBase> _local_locator;
+
+  /**
+   * The bounding box of the local elements of each processor.
+   */
+  std::vector<BoundingBox> _processor_boxes;
+
+  /**
+   * The tolerance for searches.
+   */
+  Real _close_to_point_tol;
+
+  /**
+   * \p true if \p set_close_to_point_tol() was called.
+   */
+  bool _use_close_to_point_tol;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_DISTRIBUTED_POINT_LOCATOR_H
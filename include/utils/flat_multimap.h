@@ -0,0 +1,343 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_FLAT_MULTIMAP_H
+#define LIBMESH_FLAT_MULTIMAP_H
+
+// libMesh includes
+#include "libmesh/libmesh_common.h"
+
+// C++ Includes   -----------------------------------
+#include <algorithm>
+#include <iterator>
+#include <set>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * This \p flat_multimap templated class provides the subset of the
+ * std::multimap interface used by \p BoundaryInfo, with most entries
+ * stored in a single sorted std::vector rather than in one tree node
+ * apiece.
+ *
+ * Unlike \p vectormap, lookups are allowed between insertions: new
+ * entries go into a small sorted std::multiset, and erased entries
+ * of the vector are only flagged, until enough of either have
+ * accumulated that merging them into the vector pays off.  Lookups
+ * never modify the container, so they are safe to do concurrently
+ * from several threads.
+ *
+ * Entries with equal keys are kept in insertion order, and iteration
+ * visits all entries in key order, just like a std::multimap.
+ * Erasing through an iterator invalidates only that iterator;
+ * \p insert(), \p erase(key) and \p clear() invalidate all of them.
+ */
+template <typename Key, typename Tp>
+class flat_multimap
+{
+public:
+
+  typedef Key                     key_type;
+  typedef Tp                      mapped_type;
+  typedef std::pair<Key, Tp>      value_type;
+
+private:
+
+  /**
+   * Strict weak ordering, based solely on first element in a pair.
+   */
+  struct FirstOrder
+  {
+    bool operator()(const value_type & lhs,
+                    const value_type & rhs) const
+    { return lhs.first < rhs.first; }
+  };
+
+  typedef std::vector<value_type>                    vector_type;
+  typedef std::multiset<value_type, FirstOrder>      pending_type;
+  typedef typename vector_type::const_iterator       vector_iter;
+  typedef typename pending_type::const_iterator      pending_iter;
+
+public:
+
+  /**
+   * Iterator over the union of the sorted vector and the pending
+   * set, visiting entries in key order.
+   */
+  class const_iterator
+  {
+  public:
+    typedef std::forward_iterator_tag  iterator_category;
+    typedef typename flat_multimap::value_type value_type;
+    typedef std::ptrdiff_t             difference_type;
+    typedef const value_type *         pointer;
+    typedef const value_type &         reference;
+
+    const_iterator () :
+      _map(libmesh_nullptr) {}
+
+    reference operator* () const
+    { return this->on_vector() ? *_v : *_p; }
+
+    pointer operator-> () const
+    { return &(this->operator*()); }
+
+    const_iterator & operator++ ()
+    {
+      if (this->on_vector())
+        {
+          ++_v;
+          this->skip_erased();
+        }
+      else
+        ++_p;
+      return *this;
+    }
+
+    const_iterator operator++ (int)
+    {
+      const_iterator i = *this;
+      ++(*this);
+      return i;
+    }
+
+    bool operator== (const const_iterator & other) const
+    { return _v == other._v && _p == other._p; }
+
+    bool operator!= (const const_iterator & other) const
+    { return !(*this == other); }
+
+  private:
+    friend class flat_multimap;
+
+    const_iterator (const flat_multimap & map,
+                    vector_iter v, vector_iter v_end,
+                    pending_iter p, pending_iter p_end) :
+      _map(&map), _v(v), _v_end(v_end), _p(p), _p_end(p_end)
+    { this->skip_erased(); }
+
+    // On ties the vector entry comes first: it was inserted earlier.
+    bool on_vector () const
+    {
+      return _v != _v_end &&
+        (_p == _p_end || !(_p->first < _v->first));
+    }
+
+    void skip_erased ()
+    {
+      while (_v != _v_end &&
+             _map->_erased[_v - _map->_sorted.begin()])
+        ++_v;
+    }
+
+    const flat_multimap * _map;
+    vector_iter _v, _v_end;
+    pending_iter _p, _p_end;
+  };
+
+  typedef const_iterator iterator;
+
+  /**
+   * Default constructor.
+   */
+  flat_multimap () :
+    _n_erased(0)
+  {}
+
+  const_iterator begin () const
+  {
+    return const_iterator(*this, _sorted.begin(), _sorted.end(),
+                          _pending.begin(), _pending.end());
+  }
+
+  const_iterator end () const
+  {
+    return const_iterator(*this, _sorted.end(), _sorted.end(),
+                          _pending.end(), _pending.end());
+  }
+
+  /**
+   * \returns The number of entries.
+   */
+  std::size_t size () const
+  { return _sorted.size() - _n_erased + _pending.size(); }
+
+  bool empty () const
+  { return this->size() == 0; }
+
+  void clear ()
+  {
+    _sorted.clear();
+    _erased.clear();
+    _pending.clear();
+    _n_erased = 0;
+  }
+
+  /**
+   * Inserts \p x after any entries with an equal key.
+   */
+  void insert (const value_type & x)
+  {
+    // Appending in key order needs no pending entry at all
+    if (_pending.empty() &&
+        (_sorted.empty() || !(x.first < _sorted.back().first)))
+      {
+        _sorted.push_back(x);
+        _erased.push_back(false);
+        return;
+      }
+
+    _pending.insert(x);
+    this->maybe_compact();
+  }
+
+  /**
+   * \returns The range of entries with key \p key.
+   */
+  std::pair<const_iterator, const_iterator>
+  equal_range (const key_type & key) const
+  {
+    value_type to_find;
+    to_find.first = key;
+
+    const std::pair<vector_iter, vector_iter> v =
+      std::equal_range(_sorted.begin(), _sorted.end(), to_find, FirstOrder());
+    const std::pair<pending_iter, pending_iter> p =
+      _pending.equal_range(to_find);
+
+    return std::make_pair
+      (const_iterator(*this, v.first, v.second, p.first, p.second),
+       const_iterator(*this, v.second, v.second, p.second, p.second));
+  }
+
+  /**
+   * Erases the entry at \p it.  Other iterators stay valid.
+   */
+  void erase (const_iterator it)
+  {
+    libmesh_assert(it._map == this);
+
+    if (it.on_vector())
+      {
+        const std::size_t i = it._v - _sorted.begin();
+        libmesh_assert(!_erased[i]);
+        _erased[i] = true;
+        ++_n_erased;
+      }
+    else
+      {
+        libmesh_assert(it._p != it._p_end);
+
+        // Find the same entry through a mutable iterator; some older
+        // compilers don't support erasing with const_iterators.
+        std::pair<typename pending_type::iterator,
+                  typename pending_type::iterator>
+          range = _pending.equal_range(*it._p);
+        for (; range.first != range.second; ++range.first)
+          if (&*range.first == &*it._p)
+            {
+              _pending.erase(range.first);
+              return;
+            }
+        libmesh_error_msg("flat_multimap::erase() called with an invalid iterator");
+      }
+  }
+
+  /**
+   * Erases all entries with key \p key.
+   *
+   * \returns The number of entries erased.
+   */
+  std::size_t erase (const key_type & key)
+  {
+    const std::size_t old_size = this->size();
+
+    std::pair<const_iterator, const_iterator> range = this->equal_range(key);
+    while (range.first != range.second)
+      this->erase(range.first++);
+
+    this->maybe_compact();
+
+    return old_size - this->size();
+  }
+
+  /**
+   * Merges all pending insertions and erasures into the sorted
+   * vector.
+   */
+  void compact ()
+  {
+    if (_pending.empty() && !_n_erased)
+      return;
+
+    vector_type merged;
+    merged.reserve(this->size());
+
+    vector_iter v = _sorted.begin();
+    pending_iter p = _pending.begin();
+    for (; v != _sorted.end(); ++v)
+      {
+        if (_erased[v - _sorted.begin()])
+          continue;
+        for (; p != _pending.end() && p->first < v->first; ++p)
+          merged.push_back(*p);
+        merged.push_back(*v);
+      }
+    merged.insert(merged.end(), p, _pending.end());
+
+    _sorted.swap(merged);
+    _erased.assign(_sorted.size(), false);
+    _pending.clear();
+    _n_erased = 0;
+  }
+
+private:
+
+  /**
+   * Merges the pending set and the erased entries into the vector
+   * once they make up a large enough fraction of it that the merge
+   * cost is amortized.
+   */
+  void maybe_compact ()
+  {
+    const std::size_t threshold =
+      std::max(std::size_t(64), _sorted.size()/8);
+
+    if (_pending.size() > threshold || _n_erased > threshold)
+      this->compact();
+  }
+
+  /**
+   * The sorted entries, and which of them have been erased.
+   */
+  vector_type _sorted;
+  std::vector<bool> _erased;
+  std::size_t _n_erased;
+
+  /**
+   * Entries inserted out of order since the last \p compact().
+   */
+  pending_type _pending;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_FLAT_MULTIMAP_H
@@ -93,43 +93,56 @@ void final(uint32_t & a, uint32_t & b, uint32_t & c)
 
 
 /**
- * fnv_64_buf - perform a 64 bit Fowler/Noll/Vo hash on a buffer.
- * http://www.isthe.com/chongo/tech/comp/fnv/index.html
+ * Rotate the 64-bit x by k bits.
+ */
+inline
+uint64_t rot64(uint64_t x, unsigned int k)
+{
+  return (x<<k) | (x>>(64-k));
+}
+
+
+
+/**
+ * The MurmurHash3 64-bit finalizer, which mixes every bit of h into
+ * every bit of the result.
  *
- * \author Phong Vo (http://www.research.att.com/info/kpv/)
- * \author Glenn Fowler (http://www.research.att.com/~gsf/)
- * \author Landon Curt Noll (http://www.isthe.com/chongo/)
- * \date 1991, 2012
+ * \author Austin Appleby
+ * \date 2011
  * \copyright Public Domain
- *
- * \param buf start of buffer to hash
- * \param len length of buffer in octets
- * \returns 64 bit hash as a static hash type
+ * https://github.com/aappleby/smhasher
  */
-uint64_t fnv_64_buf(const void * buf, size_t len)
+inline
+uint64_t fmix64(uint64_t h)
 {
-  // Initializing hval with this value corresponds to the FNV-1 hash algorithm.
-  uint64_t hval = static_cast<uint64_t>(0xcbf29ce484222325ULL);
-
-  // start of buffer
-  const unsigned char * bp = static_cast<const unsigned char *>(buf);
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+}
 
-  // beyond end of buffer
-  const unsigned char * be = bp + len;
 
-  // FNV-1 hash each octet of the buffer
-  while (bp < be)
-    {
-      hval +=
-        (hval << 1) + (hval << 4) + (hval << 5) +
-        (hval << 7) + (hval << 8) + (hval << 40);
 
-      // xor the bottom with the current octet
-      hval ^= static_cast<uint64_t>(*bp++);
-    }
+/**
+ * Mixes the 64-bit word k into the running MurmurHash3 state h.
+ *
+ * \author Austin Appleby
+ * \date 2011
+ * \copyright Public Domain
+ * https://github.com/aappleby/smhasher
+ */
+inline
+void mix64(uint64_t & h, uint64_t k)
+{
+  k *= 0x87c37b91114253d5ULL;
+  k = rot64(k, 31);
+  k *= 0x4cf5ad432745937fULL;
 
-  // return our new hash value
-  return hval;
+  h ^= k;
+  h = rot64(h, 27);
+  h = h*5 + 0x52dce729;
 }
 
 } // end anonymous namespace
@@ -219,18 +232,18 @@ uint32_t hashword2(const uint32_t & first, const uint32_t & second, uint32_t ini
 }
 
 /**
- * Call the 64-bit FNV hash function.
+ * This is a hard-coded version of the 64-bit hashword() below for
+ * hashing exactly 2 numbers.
  */
 inline
 uint64_t hashword2(const uint64_t first, const uint64_t second)
 {
-  // This isn't optimal (it would be nice to avoid this packing step)
-  // but we are going to go ahead and conform to the 32-bit
-  // hashword2() interface.
-  uint64_t k[2] = {first, second};
+  uint64_t h = 0;
+  mix64(h, first);
+  mix64(h, second);
 
-  // len is the total number of bytes in two 64-bit ints
-  return fnv_64_buf(k, /*len=*/8*2);
+  h ^= 2;
+  return fmix64(h);
 }
 
 inline
@@ -240,12 +253,22 @@ uint16_t hashword2(const uint16_t first, const uint16_t second)
 }
 
 /**
- * Call the 64-bit FNV hash function.
+ * The 64-bit hashword function takes an array of uint64_t's of length
+ * 'length' and computes a single key from it.  This is the body of
+ * the MurmurHash3 x64 algorithm applied a whole word at a time, so it
+ * costs a few multiplies per word rather than one per byte, and it
+ * spreads nearby node ids over all 64 bits of the key.
  */
 inline
 uint64_t hashword(const uint64_t * k, size_t length)
 {
-  return fnv_64_buf(k, 8*length);
+  uint64_t h = 0;
+
+  for (size_t i = 0; i != length; ++i)
+    mix64(h, k[i]);
+
+  h ^= static_cast<uint64_t>(length);
+  return fmix64(h);
 }
 
 
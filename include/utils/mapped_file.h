@@ -0,0 +1,89 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_MAPPED_FILE_H
+#define LIBMESH_MAPPED_FILE_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <string>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * The bytes [offset, offset+size) of a file, mapped read-only into
+ * memory where the system supports \p mmap and read into a buffer
+ * otherwise.  Processes which map the same file share its pages.
+ *
+ * The bytes stay valid for as long as the object lives.
+ */
+class MappedFile
+{
+public:
+  /**
+   * Maps \p size bytes of \p name, starting \p offset bytes in.
+   */
+  MappedFile (const std::string & name,
+              std::size_t offset,
+              std::size_t size);
+
+  /**
+   * Maps all of \p name.
+   */
+  explicit
+  MappedFile (const std::string & name);
+
+  ~MappedFile ();
+
+  /**
+   * \returns The first mapped byte, or NULL if none were mapped.
+   */
+  const char * data () const;
+
+  std::size_t size () const { return _size; }
+
+  /**
+   * \returns The size in bytes of the file \p name.
+   */
+  static std::size_t file_size (const std::string & name);
+
+private:
+  void map (const std::string & name, std::size_t offset);
+
+  // Not copyable
+  MappedFile (const MappedFile &);
+  MappedFile & operator= (const MappedFile &);
+
+#ifdef LIBMESH_HAVE_SYS_MMAN_H
+  void * _map;
+  std::size_t _map_size;
+  std::size_t _shift;
+#else
+  std::vector<char> _buffer;
+#endif
+  std::size_t _size;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_MAPPED_FILE_H
@@ -20,8 +20,15 @@
 #ifndef LIBMESH_MAPVECTOR_H
 #define LIBMESH_MAPVECTOR_H
 
+// Local Includes -----------------------------------
+#include "libmesh/libmesh_common.h"
+
 // C++ Includes   -----------------------------------
+#include <algorithm>
+#include <cstddef>
 #include <map>
+#include <utility>
+#include <vector>
 
 namespace libMesh
 {
@@ -32,111 +39,339 @@ namespace libMesh
  * closely resembling that of a std::vector, for use with
  * DistributedMesh.
  *
+ * Entries whose indices fall in a single contiguous range are kept
+ * in a std::vector, so that lookups there cost O(1); the remaining
+ * "straggler" entries live in a std::map.  After renumbering, most of
+ * a processor's objects have contiguous ids, so most lookups hit the
+ * vector.  New entries extend the vector when they are appended near
+ * its end, and \p optimize() picks a new vector range once the
+ * distribution of indices has changed.
+ *
+ * As with a std::map, iteration visits entries in index order,
+ * entries can be inserted or erased without invalidating iterators
+ * to other entries, and an entry exists (possibly holding Val())
+ * once it has been accessed with the non-const operator[].
+ *
  * \author  Roy H. Stogner
  */
 
 template <typename Val, typename index_t=unsigned int>
-class mapvector : public std::map<index_t, Val>
+class mapvector
 {
 public:
   typedef std::map<index_t, Val> maptype;
 
+  mapvector() : _dense_first(0), _n_dense(0) {}
+
   Val & operator[] (const index_t & k)
   {
-    return maptype::operator[](k);
+    if (this->in_dense_range(k))
+      {
+        const std::size_t i = k - _dense_first;
+        if (!_dense_present[i])
+          {
+            _dense_present[i] = true;
+            ++_n_dense;
+          }
+        return _dense[i];
+      }
+
+    if (this->can_extend_dense(k))
+      {
+        if (_dense.empty())
+          _dense_first = k;
+
+        const std::size_t i = k - _dense_first;
+        _dense.resize(i+1, Val());
+        _dense_present.resize(i+1, false);
+        _dense_present[i] = true;
+        ++_n_dense;
+        return _dense[i];
+      }
+
+    return _sparse[k];
   }
+
   Val operator[] (const index_t & k) const
   {
-    typename maptype::const_iterator it = this->find(k);
-    return it == this->end().it? Val() : it->second;
+    if (this->in_dense_range(k))
+      return _dense[k - _dense_first];
+
+    typename maptype::const_iterator it = _sparse.find(k);
+    return it == _sparse.end() ? Val() : it->second;
   }
 
-  class veclike_iterator
+  /**
+   * \returns 1 if there is an entry at index \p k, 0 otherwise.
+   */
+  std::size_t count (const index_t & k) const
   {
-  public:
-    veclike_iterator(const typename maptype::iterator & i)
-      : it(i) {}
-
-    veclike_iterator(const veclike_iterator & i)
-      : it(i.it) {}
+    if (this->in_dense_range(k))
+      return _dense_present[k - _dense_first];
+    return _sparse.count(k);
+  }
 
-    Val & operator*() const { return it->second; }
+  /**
+   * \returns The number of entries.
+   */
+  std::size_t size () const { return _n_dense + _sparse.size(); }
 
-    veclike_iterator & operator++() { ++it; return *this; }
+  bool empty () const { return this->size() == 0; }
 
-    veclike_iterator operator++(int) {
-      veclike_iterator i = *this;
-      ++(*this);
-      return i;
-    }
-
-    bool operator==(const veclike_iterator & other) const {
-      return it == other.it;
-    }
+  void clear ()
+  {
+    _dense.clear();
+    _dense_present.clear();
+    _dense_first = 0;
+    _n_dense = 0;
+    _sparse.clear();
+  }
 
-    bool operator!=(const veclike_iterator & other) const {
-      return it != other.it;
-    }
+private:
 
-    typename maptype::iterator it;
-  };
-
-  class const_veclike_iterator
+  /**
+   * Iterator over the vector range and the map together, in index
+   * order.  A vector position of \p npos means the vector range has
+   * been exhausted.
+   */
+  template <typename MV, typename MapIter, typename Ref>
+  class iterator_base
   {
   public:
-    const_veclike_iterator(const typename maptype::const_iterator & i)
-      : it(i) {}
-
-    const_veclike_iterator(const const_veclike_iterator & i)
-      : it(i.it) {}
-
-    const_veclike_iterator(const veclike_iterator & i)
-      : it(i.it) {}
-
-    const Val & operator*() const { return it->second; }
-
-    const_veclike_iterator & operator++() { ++it; return *this; }
+    iterator_base(MV & mv, const MapIter & s, std::size_t d)
+      : _mv(&mv), _s(s), _d(d) {}
+
+    // Allows conversion from veclike_iterator to const_veclike_iterator
+    template <typename MV2, typename MapIter2, typename Ref2>
+    iterator_base(const iterator_base<MV2, MapIter2, Ref2> & i)
+      : _mv(i._mv), _s(i._s), _d(i._d) {}
+
+    Ref operator*() const
+    { return this->on_dense() ? _mv->_dense[_d] : _s->second; }
+
+    /**
+     * \returns The index of the entry pointed to.
+     */
+    index_t key() const
+    { return this->on_dense() ? index_t(_mv->_dense_first + _d) : _s->first; }
+
+    iterator_base & operator++()
+    {
+      if (this->on_dense())
+        _d = _mv->next_dense(_d+1);
+      else
+        ++_s;
+      return *this;
+    }
 
-    const_veclike_iterator operator++(int) {
-      veclike_iterator i = *this;
+    iterator_base operator++(int) {
+      iterator_base i = *this;
       ++(*this);
       return i;
     }
 
-    bool operator==(const const_veclike_iterator & other) const {
-      return it == other.it;
+    bool operator==(const iterator_base & other) const {
+      return _s == other._s && _d == other._d;
     }
 
-    bool operator!=(const const_veclike_iterator & other) const {
-      return it != other.it;
+    bool operator!=(const iterator_base & other) const {
+      return !(*this == other);
     }
 
-    typename maptype::const_iterator it;
+  private:
+    friend class mapvector;
+    template <typename MV2, typename MapIter2, typename Ref2>
+    friend class iterator_base;
+
+    // Map entries never fall inside the vector range, so whichever
+    // of the two candidates has the lower index comes first.
+    bool on_dense() const
+    {
+      return _d != npos &&
+        (_s == _mv->_sparse.end() ||
+         index_t(_mv->_dense_first + _d) < _s->first);
+    }
+
+    MV * _mv;
+    MapIter _s;
+    std::size_t _d;
   };
 
+public:
+
+  typedef iterator_base<mapvector, typename maptype::iterator, Val &>
+  veclike_iterator;
+
+  typedef iterator_base<const mapvector, typename maptype::const_iterator, const Val &>
+  const_veclike_iterator;
+
   void erase(index_t i) {
-    maptype::erase(i);
+    if (this->in_dense_range(i))
+      {
+        const std::size_t d = i - _dense_first;
+        if (_dense_present[d])
+          {
+            _dense_present[d] = false;
+            _dense[d] = Val();
+            --_n_dense;
+          }
+      }
+    else
+      _sparse.erase(i);
   }
 
   void erase(const veclike_iterator & pos) {
-    maptype::erase(pos.it);
+    if (pos.on_dense())
+      {
+        libmesh_assert(_dense_present[pos._d]);
+        _dense_present[pos._d] = false;
+        _dense[pos._d] = Val();
+        --_n_dense;
+      }
+    else
+      _sparse.erase(pos._s);
   }
 
   veclike_iterator begin() {
-    return veclike_iterator(maptype::begin());
+    return veclike_iterator(*this, _sparse.begin(), this->next_dense(0));
   }
 
   const_veclike_iterator begin() const {
-    return const_veclike_iterator(maptype::begin());
+    return const_veclike_iterator(*this, _sparse.begin(), this->next_dense(0));
   }
 
   veclike_iterator end() {
-    return veclike_iterator(maptype::end());
+    return veclike_iterator(*this, _sparse.end(), npos);
   }
 
   const_veclike_iterator end() const {
-    return const_veclike_iterator(maptype::end());
+    return const_veclike_iterator(*this, _sparse.end(), npos);
+  }
+
+  /**
+   * \returns One more than the highest index whose entry is not
+   * Val(), or 0 if there is no such entry.
+   */
+  index_t end_of_nonnull_range() const
+  {
+    typename maptype::const_reverse_iterator rit = _sparse.rbegin();
+    for (; rit != _sparse.rend() && rit->first >= this->dense_end(); ++rit)
+      if (rit->second != Val())
+        return rit->first + 1;
+
+    for (std::size_t d = _dense.size(); d != 0; --d)
+      if (_dense[d-1] != Val())
+        return index_t(_dense_first + d);
+
+    for (; rit != _sparse.rend(); ++rit)
+      if (rit->second != Val())
+        return rit->first + 1;
+
+    return 0;
   }
+
+  /**
+   * Chooses a new contiguous range of indices to store in the
+   * vector: the longest run of entries without large gaps in their
+   * indices.  This invalidates all iterators, and is worth calling
+   * after the indices have been renumbered or redistributed.
+   */
+  void optimize()
+  {
+    std::vector<std::pair<index_t, Val> > entries;
+    entries.reserve(this->size());
+    for (const_veclike_iterator it = this->begin(); it != this->end(); ++it)
+      entries.push_back(std::make_pair(it.key(), *it));
+
+    std::size_t best_begin = 0, best_end = 0;
+    for (std::size_t run_begin = 0; run_begin != entries.size();)
+      {
+        std::size_t run_end = run_begin + 1;
+        while (run_end != entries.size() &&
+               entries[run_end].first - entries[run_end-1].first <= max_gap)
+          ++run_end;
+
+        if (run_end - run_begin > best_end - best_begin)
+          {
+            best_begin = run_begin;
+            best_end = run_end;
+          }
+        run_begin = run_end;
+      }
+
+    this->clear();
+
+    if (best_end != best_begin)
+      {
+        _dense_first = entries[best_begin].first;
+        const std::size_t n = entries[best_end-1].first - _dense_first + 1;
+        _dense.resize(n, Val());
+        _dense_present.resize(n, false);
+        for (std::size_t e = best_begin; e != best_end; ++e)
+          {
+            const std::size_t d = entries[e].first - _dense_first;
+            _dense[d] = entries[e].second;
+            _dense_present[d] = true;
+          }
+        _n_dense = best_end - best_begin;
+      }
+
+    for (std::size_t e = 0; e != entries.size(); ++e)
+      if (e < best_begin || e >= best_end)
+        _sparse.insert(_sparse.end(), entries[e]);
+  }
+
+private:
+
+  static const std::size_t npos = static_cast<std::size_t>(-1);
+
+  /**
+   * Gaps in the indices of up to this size are filled with empty
+   * vector entries rather than splitting the vector range.
+   */
+  static const std::size_t max_gap = 64;
+
+  index_t dense_end() const
+  { return index_t(_dense_first + _dense.size()); }
+
+  bool in_dense_range (const index_t & k) const
+  { return k >= _dense_first && k < this->dense_end() && !_dense.empty(); }
+
+  /**
+   * \returns true if the vector range can grow to include the index
+   * \p k without overlapping the range of any map entry.
+   */
+  bool can_extend_dense (const index_t & k) const
+  {
+    if (_dense.empty())
+      return _sparse.empty() || _sparse.rbegin()->first < k;
+
+    const index_t end = this->dense_end();
+    if (k < end || k - end > max_gap)
+      return false;
+
+    typename maptype::const_iterator it = _sparse.lower_bound(end);
+    return it == _sparse.end() || it->first > k;
+  }
+
+  /**
+   * \returns The first vector position at or after \p d holding an
+   * entry, or \p npos.
+   */
+  std::size_t next_dense (std::size_t d) const
+  {
+    for (; d < _dense.size(); ++d)
+      if (_dense_present[d])
+        return d;
+    return npos;
+  }
+
+  index_t _dense_first;
+  std::vector<Val> _dense;
+  std::vector<bool> _dense_present;
+  std::size_t _n_dense;
+
+  maptype _sparse;
 };
 
 } // namespace libMesh
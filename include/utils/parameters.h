@@ -31,11 +31,15 @@
 #include "libmesh/print_trace.h"
 
 // C++ includes
+#include <algorithm>
 #include <cstddef>
 #include <map>
 #include <string>
 #include <typeinfo>
 #include <sstream>
+#include <utility>
+#include <vector>
+#include LIBMESH_INCLUDE_UNORDERED_MAP
 
 namespace libMesh
 {
@@ -57,6 +61,10 @@ void print_helper(std::ostream & os, const std::vector<std::vector<P> > * param)
  * types.  This can be used to provide arbitrary
  * user-specified options.
  *
+ * Parameters are stored in a hash table.  Code which reads a
+ * parameter in a loop should fetch a pointer to it once, with \p
+ * get_ptr() or \p set_ptr(), rather than call \p get() every time.
+ *
  * \author Benjamin S. Kirk
  * \date 2004
  */
@@ -126,6 +134,26 @@ public:
   template <typename T>
   T & set (const std::string &);
 
+  /**
+   * \returns A pointer to the value of the specified parameter,
+   * which must exist.  Reading through the pointer costs no lookup
+   * and sees any later change to the parameter.  The pointer stays
+   * valid until the parameter is removed or replaced by one of
+   * another type, or \p this is cleared or destroyed.  Assigning or
+   * adding other Parameters updates values of the same name and type
+   * in place.
+   */
+  template <typename T>
+  const T * get_ptr (const std::string &) const;
+
+  /**
+   * \returns A writable pointer to the value of the specified
+   * parameter, which is created if it does not exist.  It stays
+   * valid as long as a pointer returned by \p get_ptr() would.
+   */
+  template <typename T>
+  T * set_ptr (const std::string &);
+
   /**
    * Overridable function to set any extended attributes for
    * classes inheriting from this class.
@@ -193,6 +221,13 @@ private:
      * Must be reimplemented in derived classes.
      */
     virtual Value * clone () const = 0;
+
+    /**
+     * Copies the value of \p other, if it is of the same type.
+     * \returns \p false, and leaves this value unchanged, if it is
+     * not.
+     */
+    virtual bool assign (const Value & other) = 0;
   };
 
 public:
@@ -233,6 +268,11 @@ public:
      */
     virtual Value * clone () const;
 
+    /**
+     * Copies the value of \p other, if it is a \p Parameter<T>.
+     */
+    virtual bool assign (const Value & other);
+
   private:
     /**
      * Stored parameter value.
@@ -241,14 +281,47 @@ public:
   };
 
   /**
-   * Parameter map iterator.
+   * Hash function for parameter names.
    */
-  typedef std::map<std::string, Value *>::iterator iterator;
+  struct NameHash
+  {
+    std::size_t operator() (const std::string & name) const
+    {
+      // FNV-1a
+      std::size_t h = static_cast<std::size_t>(2166136261u);
+      for (std::string::const_iterator c = name.begin(); c != name.end(); ++c)
+        h = (h ^ static_cast<unsigned char>(*c)) * static_cast<std::size_t>(16777619u);
+      return h;
+    }
+  };
+
+  // Only the hashed containers take a hash function
+#if defined(LIBMESH_HAVE_STD_UNORDERED_MAP) ||  \
+  defined(LIBMESH_HAVE_TR1_UNORDERED_MAP) ||    \
+  defined(LIBMESH_HAVE_EXT_HASH_MAP) ||         \
+  defined(LIBMESH_HAVE_HASH_MAP)
+#  define LIBMESH_PARAMETERS_HASH ,NameHash
+#else
+#  define LIBMESH_PARAMETERS_HASH
+#endif
+
+  /**
+   * The container of named parameter values.
+   */
+  typedef LIBMESH_BEST_UNORDERED_MAP<std::string, Value * LIBMESH_PARAMETERS_HASH> map_type;
+
+#undef LIBMESH_PARAMETERS_HASH
+
+  /**
+   * Parameter map iterator.  Parameters are visited in no particular
+   * order.
+   */
+  typedef map_type::iterator iterator;
 
   /**
    * Constant parameter map iterator.
    */
-  typedef std::map<std::string, Value *>::const_iterator const_iterator;
+  typedef map_type::const_iterator const_iterator;
 
   /**
    * Iterator pointing to the beginning of the set of parameters.
@@ -275,7 +348,7 @@ protected:
   /**
    * Data structure to map names with values.
    */
-  std::map<std::string, Value *> _values;
+  map_type _values;
 
 };
 
@@ -314,6 +387,26 @@ Parameters::Value * Parameters::Parameter<T>::clone () const
   return copy;
 }
 
+template <typename T>
+inline
+bool Parameters::Parameter<T>::assign (const Value & other)
+{
+  // Without RTTI we cannot tell whether the types match, so the
+  // caller will have to replace this value instead.
+#ifdef LIBMESH_HAVE_RTTI
+  const Parameter<T> * same = dynamic_cast<const Parameter<T> *>(&other);
+  if (same)
+    {
+      _value = same->_value;
+      return true;
+    }
+#else
+  libmesh_ignore(other);
+#endif
+
+  return false;
+}
+
 
 // ------------------------------------------------------------
 // Parameters class inline methods
@@ -336,7 +429,21 @@ void Parameters::clear () // since this is inline we must define it
 inline
 Parameters & Parameters::operator= (const Parameters & source)
 {
-  this->clear();
+  if (&source == this)
+    return *this;
+
+  // Remove the parameters which source does not have, and keep the
+  // others so that their values can be updated in place.
+  Parameters::iterator it = _values.begin();
+  while (it != _values.end())
+    if (source._values.find(it->first) == source._values.end())
+      {
+        delete it->second;
+        _values.erase(it++);
+      }
+    else
+      ++it;
+
   *this += source;
 
   return *this;
@@ -345,12 +452,20 @@ Parameters & Parameters::operator= (const Parameters & source)
 inline
 Parameters & Parameters::operator+= (const Parameters & source)
 {
+  if (&source == this)
+    return *this;
+
   for (Parameters::const_iterator it = source._values.begin();
        it != source._values.end(); ++it)
     {
-      if (_values.find(it->first) != _values.end())
-        delete _values[it->first];
-      _values[it->first] = it->second->clone();
+      Parameters::iterator existing = _values.find(it->first);
+      if (existing == _values.end())
+        _values.insert(std::make_pair(it->first, it->second->clone()));
+      else if (!existing->second->assign(*it->second))
+        {
+          delete existing->second;
+          existing->second = it->second->clone();
+        }
     }
 
   return *this;
@@ -359,7 +474,7 @@ Parameters & Parameters::operator+= (const Parameters & source)
 inline
 Parameters::Parameters (const Parameters & p)
 {
-  *this = p;
+  *this += p;
 }
 
 
@@ -375,20 +490,24 @@ Parameters::~Parameters ()
 inline
 void Parameters::print (std::ostream & os) const
 {
-  Parameters::const_iterator it = _values.begin();
+  // Print in order of name, regardless of how they are stored
+  std::vector<std::pair<std::string, const Value *> > sorted_values;
+  sorted_values.reserve(_values.size());
+  for (Parameters::const_iterator it = _values.begin();
+       it != _values.end(); ++it)
+    sorted_values.push_back(std::make_pair(it->first, it->second));
+  std::sort(sorted_values.begin(), sorted_values.end());
 
   os << "Name\t Type\t Value\n"
      << "---------------------\n";
-  while (it != _values.end())
+  for (std::size_t i = 0; i != sorted_values.size(); ++i)
     {
-      os << " "   << it->first
+      os << " "   << sorted_values[i].first
 #ifdef LIBMESH_HAVE_RTTI
-         << "\t " << it->second->type()
+         << "\t " << sorted_values[i].second->type()
 #endif // LIBMESH_HAVE_RTTI
-         << "\t ";   it->second->print(os);
+         << "\t ";   sorted_values[i].second->print(os);
       os << '\n';
-
-      ++it;
     }
 }
 
@@ -428,6 +547,13 @@ bool Parameters::have_parameter (const std::string & name) const
 template <typename T>
 inline
 const T & Parameters::get (const std::string & name) const
+{
+  return *this->get_ptr<T>(name);
+}
+
+template <typename T>
+inline
+const T * Parameters::get_ptr (const std::string & name) const
 {
   if (!this->have_parameter<T>(name))
     {
@@ -450,7 +576,7 @@ const T & Parameters::get (const std::string & name) const
   libmesh_assert(it != _values.end());
   libmesh_assert(it->second);
 
-  return cast_ptr<Parameter<T> *>(it->second)->get();
+  return &cast_ptr<Parameter<T> *>(it->second)->get();
 }
 
 template <typename T>
@@ -458,7 +584,12 @@ inline
 void Parameters::insert (const std::string & name)
 {
   if (!this->have_parameter<T>(name))
-    _values[name] = new Parameter<T>;
+    {
+      // Replace any parameter of another type
+      Value * & value = _values[name];
+      delete value;
+      value = new Parameter<T>;
+    }
 
   set_attributes(name, true);
 }
@@ -467,13 +598,26 @@ void Parameters::insert (const std::string & name)
 template <typename T>
 inline
 T & Parameters::set (const std::string & name)
+{
+  return *this->set_ptr<T>(name);
+}
+
+
+template <typename T>
+inline
+T * Parameters::set_ptr (const std::string & name)
 {
   if (!this->have_parameter<T>(name))
-    _values[name] = new Parameter<T>;
+    {
+      // Replace any parameter of another type
+      Value * & value = _values[name];
+      delete value;
+      value = new Parameter<T>;
+    }
 
   set_attributes(name, false);
 
-  return cast_ptr<Parameter<T> *>(_values[name])->set();
+  return &cast_ptr<Parameter<T> *>(_values[name])->set();
 }
 
 inline
@@ -23,18 +23,25 @@
 
 // Local includes
 #include "libmesh/libmesh_common.h"
+#include "libmesh/perfmon.h"
 
 // C++ includes
 #include <cstddef>
+#include <iosfwd>
 #include <map>
-#include <stack>
 #include <string>
 #include <vector>
 #include <sys/time.h>
+#include <time.h>
 
 namespace libMesh
 {
 
+// Forward declarations
+namespace Parallel {
+class Communicator;
+}
+
 /**
  * The \p PerfData class simply contains the performance
  * data that is recorded for individual events.
@@ -53,11 +60,14 @@ public:
   PerfData () :
     tot_time(0.),
     tot_time_incl_sub(0.),
-    tstart(),
-    tstart_incl_sub(),
+    tstart(0.),
+    tstart_incl_sub(0.),
     count(0),
     open(false),
-    called_recursively(0)
+    called_recursively(0),
+    peak_rss_growth(0),
+    n_allocations(0),
+    allocated_bytes(0)
   {}
 
 
@@ -72,16 +82,16 @@ public:
   double tot_time_incl_sub;
 
   /**
-   * Structure defining when the event
+   * The time, from \p current_time(), when the event
    * was last started.
    */
-  struct timeval tstart;
+  double tstart;
 
   /**
-   * Structure defining when the event
+   * The time, from \p current_time(), when the event
    * was last started, including sub-events.
    */
-  struct timeval tstart_incl_sub;
+  double tstart_incl_sub;
 
   /**
    * The number of times this event has
@@ -103,6 +113,32 @@ public:
 
   int called_recursively;
 
+  /**
+   * The hardware events counted in this event, without sub-events,
+   * if the PerfLog counts them.
+   */
+  HardwareCounts counts;
+
+  /**
+   * The growth of the peak resident set size of the process, in
+   * bytes, and the number and bytes of allocations made in this
+   * event, without sub-events, if the PerfLog tracks memory.
+   */
+  std::size_t peak_rss_growth;
+  unsigned long long n_allocations;
+  unsigned long long allocated_bytes;
+
+  /**
+   * Adds the timings and counts of \p other to ours.
+   */
+  void merge (const PerfData & other);
+
+  /**
+   * \returns The time in seconds from a monotonic clock, when the
+   * system has one, or from the wall clock.
+   */
+  static double current_time ();
+
 protected:
   double stop_or_pause(const bool do_stop);
 };
@@ -117,6 +153,28 @@ protected:
  * This class is particulary useful for finding performance
  * bottlenecks.
  *
+ * Each event is given an integer id the first time it is seen, and
+ * pushing and popping by id touches no shared data.  If the compiler
+ * supports thread local storage, each thread keeps its own stack of
+ * events and its own data, which are merged when the log is printed,
+ * so events may be logged from within threaded loops.
+ *
+ * With tracing enabled, the start and stop time of each event is also
+ * recorded, in a buffer for each thread, and can be written as a
+ * Chrome Trace Event timeline.
+ *
+ * With hardware counters enabled, the cycles, instructions and last
+ * level cache misses of each event are counted as well, where the
+ * system allows it, and printed with the IPC and the memory bandwidth
+ * they imply.  Each push and pop then costs a system call.
+ *
+ * With memory tracking enabled, each event records how much it raised
+ * the peak resident set size of the process, which shows the phases
+ * that set the memory high water mark.  If the application also
+ * reports its allocations through \p record_allocation(), from a
+ * replacement of the global operator new for instance, the number and
+ * size of the allocations in each event are recorded as well.
+ *
  * \author Benjamin Kirk
  * \date 2003
  * \brief Responsible for timing and summarizing events.
@@ -146,6 +204,8 @@ public:
    * checks to see if it is currently monitoring any
    * events, and if so errors.  Be sure you are not
    * logging any events when you call this function.
+   *
+   * Event ids remain valid.
    */
   void clear();
 
@@ -164,6 +224,91 @@ public:
    */
   bool logging_enabled() const { return log_events; }
 
+  /**
+   * Starts recording the start and stop time of each event, in
+   * addition to the totals.  Each thread keeps at most \p
+   * max_events_per_thread events, overwriting its oldest ones.
+   * Times in the trace are relative to this call.
+   */
+  void enable_tracing(std::size_t max_events_per_thread = 1000000);
+
+  /**
+   * Stops recording events for the trace.  Events recorded so far are
+   * kept until the next \p clear().
+   */
+  void disable_tracing() { trace_events = false; }
+
+  /**
+   * \returns \p true iff event tracing is enabled
+   */
+  bool tracing_enabled() const { return trace_events; }
+
+  /**
+   * Starts counting hardware events for each event.
+   */
+  void enable_hardware_counters() { count_hardware = true; }
+
+  /**
+   * Stops counting hardware events.
+   */
+  void disable_hardware_counters() { count_hardware = false; }
+
+  /**
+   * \returns \p true iff hardware events are counted
+   */
+  bool hardware_counters_enabled() const { return count_hardware; }
+
+  /**
+   * Starts tracking the peak memory use and allocations of each
+   * event.
+   */
+  void enable_memory_tracking() { track_memory = true; }
+
+  /**
+   * Stops tracking memory.
+   */
+  void disable_memory_tracking() { track_memory = false; }
+
+  /**
+   * \returns \p true iff memory is tracked
+   */
+  bool memory_tracking_enabled() const { return track_memory; }
+
+  /**
+   * Records an allocation of \p bytes by the calling thread, for the
+   * event it is running in any PerfLog tracking memory.  This is safe
+   * to call from an allocator: it only updates thread local counts,
+   * and does nothing without thread local storage.
+   */
+  static void record_allocation (std::size_t bytes);
+
+  /**
+   * \returns The traced events of this processor as comma separated
+   * Chrome Trace Event objects, with the processor id as the pid, so
+   * that the events of several processors can be joined in one trace.
+   */
+  std::string get_trace_events() const;
+
+  /**
+   * Writes the traced events of this processor to \p os in the Chrome
+   * Trace Event format, which can be viewed in chrome://tracing or
+   * Perfetto.
+   */
+  void write_trace(std::ostream & os) const;
+
+  /**
+   * \returns The id of the event \p label with header \p header,
+   * creating it if this is the first time we have seen it.  This
+   * function is thread safe.
+   */
+  unsigned int get_event_id (const std::string & label,
+                             const std::string & header="");
+
+  /**
+   * Push the event \p event_id onto the stack, pausing any active event.
+   */
+  void push (unsigned int event_id);
+
   /**
    * Push the event \p label onto the stack, pausing any active event.
    */
@@ -176,6 +321,11 @@ public:
   void push (const std::string & label,
              const std::string & header="");
 
+  /**
+   * Pop the event \p event_id off the stack, resuming any lower event.
+   */
+  void pop (unsigned int event_id);
+
   /**
    * Pop the event \p label off the stack, resuming any lower event.
    */
@@ -234,28 +384,160 @@ public:
    */
   void print_log() const;
 
+  /**
+   * \returns On processor 0 of \p comm, a table of the minimum, mean
+   * and maximum time of each event over the processors of \p comm,
+   * with the imbalance (maximum over mean) and the processor with the
+   * maximum; an empty string elsewhere.  Processors which never logged
+   * an event count as spending no time in it.  Must be called on
+   * every processor of \p comm.
+   */
+  std::string get_parallel_perf_info(const Parallel::Communicator & comm) const;
+
+  /**
+   * Print the log reduced over \p comm, on its processor 0.  Must be
+   * called on every processor of \p comm.
+   */
+  void print_parallel_log(const Parallel::Communicator & comm) const;
+
+  /**
+   * \returns On processor 0 of \p comm, the statistics of
+   * \p get_parallel_perf_info(), for times with and without
+   * sub-events, as JSON; an empty string elsewhere.  Must be called on
+   * every processor of \p comm.
+   */
+  std::string get_json_summary(const Parallel::Communicator & comm) const;
+
   /**
    * \returns The total time spent on this event.
    */
   double get_elapsed_time() const;
 
   /**
-   * \returns The active time
+   * \returns The active time, summed over all threads
    */
   double get_active_time() const;
 
   /**
-   * Return the PerfData object associated with a label and header.
+   * Return the PerfData object associated with a label and header,
+   * merged over all threads.
    */
   PerfData get_perf_data(const std::string & label, const std::string & header="");
 
   /**
-   * \returns the raw underlying data structure for the entire performance log.
+   * \returns the raw underlying data structure for the entire
+   * performance log, merged over all threads.
    */
-  const std::map < std::pair<std::string, std::string>, PerfData > & get_log_raw() const { return log; }
+  const std::map < std::pair<std::string, std::string>, PerfData > & get_log_raw() const
+  { this->merge_thread_logs(); return log; }
 
 private:
 
+  /**
+   * One traced event.
+   */
+  struct TraceEvent
+  {
+    unsigned int event_id;
+    double start;
+    double stop;
+  };
+
+  /**
+   * The events and stack of one thread.
+   */
+  struct ThreadLog
+  {
+    ThreadLog () :
+      total_time(0.), n_traced(0), counters_tried(false),
+      last_peak_rss(0), last_n_allocations(0), last_allocated_bytes(0) {}
+
+    /**
+     * The data of each event, indexed by event id.
+     */
+    std::vector<PerfData> data;
+
+    /**
+     * The ids of the events in the current trace.
+     */
+    std::vector<unsigned int> stack;
+
+    /**
+     * The times the events in the current trace started.
+     */
+    std::vector<double> stack_start;
+
+    /**
+     * The total running time for events on this thread.
+     */
+    double total_time;
+
+    /**
+     * The traced events, a ring buffer once it is full, and the
+     * number of events traced.
+     */
+    std::vector<TraceEvent> trace;
+    std::size_t n_traced;
+
+    /**
+     * The hardware counters of this thread, whether we tried to open
+     * them, and their counts when last read.
+     */
+    HardwareCounters counters;
+    bool counters_tried;
+    HardwareCounts last_counts;
+
+    /**
+     * The peak resident set size and allocation counts when last
+     * read.
+     */
+    std::size_t last_peak_rss;
+    unsigned long long last_n_allocations;
+    unsigned long long last_allocated_bytes;
+  };
+
+  /**
+   * \returns The log of the current thread.
+   */
+  ThreadLog & get_thread_log ();
+
+  /**
+   * Finds, or creates, the log of the current thread.
+   */
+  ThreadLog & find_thread_log ();
+
+  /**
+   * Adds the hardware events counted since the last call to the event
+   * on top of the stack of \p thread_log.
+   */
+  void count_hardware_events (ThreadLog & thread_log);
+
+  /**
+   * Adds the peak memory growth and allocations since the last call
+   * to the event on top of the stack of \p thread_log.
+   */
+  void track_memory_events (ThreadLog & thread_log);
+
+  /**
+   * \returns A table of the hardware counts in \p log.
+   */
+  std::string get_counter_info () const;
+
+  /**
+   * \returns A table of the memory use in \p log.
+   */
+  std::string get_memory_info () const;
+
+  /**
+   * Fills \p log with the data of all threads.
+   */
+  void merge_thread_logs () const;
+
+  /**
+   * Reports a pop which doesn't match the top of the stack.
+   */
+  void report_bad_pop (unsigned int event_id,
+                       unsigned int top_id) const;
 
   /**
    * The label for this object.
@@ -268,26 +550,74 @@ private:
   bool log_events;
 
   /**
-   * The total running time for recorded events.
+   * Flag to enable tracing, the size of each thread's trace buffer,
+   * and the time tracing was enabled.
+   */
+  bool trace_events;
+  std::size_t max_trace_events;
+  double trace_start;
+
+  /**
+   * Flag to enable hardware counters.
    */
-  double total_time;
+  bool count_hardware;
+
+  /**
+   * Flag to enable memory tracking.
+   */
+  bool track_memory;
+
+  /**
+   * The total running time for recorded events, updated by
+   * merge_thread_logs().
+   */
+  mutable double total_time;
 
   /**
    * The time we were constructed or last cleared.
    */
-  struct timeval tstart;
+  double tstart;
+
+  /**
+   * The actual log, merged over all threads by merge_thread_logs().
+   */
+  mutable std::map<std::pair<std::string,
+                             std::string>,
+                   PerfData> log;
+
+  /**
+   * The (header, label) of each event, indexed by event id, and the
+   * id of each event.
+   */
+  std::vector<std::pair<std::string, std::string> > event_names;
+  std::map<std::pair<std::string, std::string>, unsigned int> event_ids;
 
   /**
-   * The actual log.
+   * The log of each thread which has logged an event, by thread
+   * number.
    */
-  std::map<std::pair<std::string,
-                     std::string>,
-           PerfData> log;
+  std::map<unsigned int, ThreadLog *> thread_logs;
 
   /**
-   * A stack to hold the current performance log trace.
+   * A number identifying this object, unique over the run.
    */
-  std::stack<PerfData*> log_stack;
+  unsigned int log_id;
+
+#ifdef LIBMESH_TLS
+  /**
+   * The PerfLog, by log_id, whose thread log the current thread used
+   * last, and that thread log.
+   */
+  static LIBMESH_TLS unsigned int tls_log_id;
+  static LIBMESH_TLS ThreadLog * tls_thread_log;
+
+  /**
+   * The number and bytes of allocations recorded by the current
+   * thread.
+   */
+  static LIBMESH_TLS unsigned long long tls_n_allocations;
+  static LIBMESH_TLS unsigned long long tls_allocated_bytes;
+#endif
 
   /**
    * Flag indicating if print_log() has been called.
@@ -308,12 +638,30 @@ private:
 
 // ------------------------------------------------------------
 // PerfData class member funcions
+inline
+double PerfData::current_time ()
+{
+#ifdef CLOCK_MONOTONIC
+  struct timespec tnow;
+  clock_gettime (CLOCK_MONOTONIC, &tnow);
+  return static_cast<double>(tnow.tv_sec) +
+    static_cast<double>(tnow.tv_nsec)*1.e-9;
+#else
+  struct timeval tnow;
+  gettimeofday (&tnow, libmesh_nullptr);
+  return static_cast<double>(tnow.tv_sec) +
+    static_cast<double>(tnow.tv_usec)*1.e-6;
+#endif
+}
+
+
+
 inline
 void PerfData::start ()
 {
   this->count++;
   this->called_recursively++;
-  gettimeofday (&(this->tstart), libmesh_nullptr);
+  this->tstart = current_time();
   this->tstart_incl_sub = this->tstart;
 }
 
@@ -322,7 +670,7 @@ void PerfData::start ()
 inline
 void PerfData::restart ()
 {
-  gettimeofday (&(this->tstart), libmesh_nullptr);
+  this->tstart = current_time();
 }
 
 
@@ -337,26 +685,16 @@ double PerfData::pause ()
 inline
 double PerfData::stop_or_pause(const bool do_stop)
 {
-  // save the start times, reuse the structure we have rather than create
-  // a new one.
-  const time_t
-    tstart_tv_sec  = this->tstart.tv_sec,
-    tstart_tv_usec = this->tstart.tv_usec;
+  const double tnow = current_time();
 
-  gettimeofday (&(this->tstart), libmesh_nullptr);
+  const double elapsed_time = tnow - this->tstart;
 
-  const double elapsed_time = (static_cast<double>(this->tstart.tv_sec  - tstart_tv_sec) +
-                               static_cast<double>(this->tstart.tv_usec - tstart_tv_usec)*1.e-6);
+  this->tstart = tnow;
 
   this->tot_time += elapsed_time;
 
   if (do_stop)
-    {
-      const double elapsed_time_incl_sub = (static_cast<double>(this->tstart.tv_sec  - this->tstart_incl_sub.tv_sec) +
-                                            static_cast<double>(this->tstart.tv_usec - this->tstart_incl_sub.tv_usec)*1.e-6);
-
-      this->tot_time_incl_sub += elapsed_time_incl_sub;
-    }
+    this->tot_time_incl_sub += tnow - this->tstart_incl_sub;
 
   return elapsed_time;
 }
@@ -375,29 +713,75 @@ double PerfData::stopit ()
 
 
 
+inline
+void PerfData::merge (const PerfData & other)
+{
+  this->tot_time += other.tot_time;
+  this->tot_time_incl_sub += other.tot_time_incl_sub;
+  this->count += other.count;
+  this->open = this->open || other.open;
+  this->counts += other.counts;
+  this->peak_rss_growth += other.peak_rss_growth;
+  this->n_allocations += other.n_allocations;
+  this->allocated_bytes += other.allocated_bytes;
+}
+
+
+
 // ------------------------------------------------------------
 // PerfLog class inline member funcions
 inline
-void PerfLog::push (const std::string & label,
-                    const std::string & header)
+PerfLog::ThreadLog & PerfLog::get_thread_log ()
+{
+#ifdef LIBMESH_TLS
+  if (tls_log_id == log_id)
+    return *tls_thread_log;
+#endif
+
+  return this->find_thread_log();
+}
+
+
+
+inline
+void PerfLog::push (unsigned int event_id)
 {
   if (this->log_events)
     {
-      // Get a reference to the event data to avoid
-      // repeated map lookups
-      PerfData * perf_data = &(log[std::make_pair(header,label)]);
+      ThreadLog & thread_log = this->get_thread_log();
+
+      if (event_id >= thread_log.data.size())
+        thread_log.data.resize(event_id + 1);
 
-      if (!log_stack.empty())
-        total_time +=
-          log_stack.top()->pause();
+      if (count_hardware)
+        this->count_hardware_events(thread_log);
 
-      perf_data->start();
-      log_stack.push(perf_data);
+      if (track_memory)
+        this->track_memory_events(thread_log);
+
+      if (!thread_log.stack.empty())
+        thread_log.total_time +=
+          thread_log.data[thread_log.stack.back()].pause();
+
+      PerfData & perf_data = thread_log.data[event_id];
+      perf_data.start();
+      thread_log.stack.push_back(event_id);
+      thread_log.stack_start.push_back(perf_data.tstart);
     }
 }
 
 
 
+inline
+void PerfLog::push (const std::string & label,
+                    const std::string & header)
+{
+  if (this->log_events)
+    this->push(this->get_event_id(label, header));
+}
+
+
+
 inline
 void PerfLog::push (const char * label,
                     const char * header)
@@ -409,40 +793,63 @@ void PerfLog::push (const char * label,
 
 
 inline
-void PerfLog::pop (const std::string & libmesh_dbg_var(label),
-                   const std::string & libmesh_dbg_var(header))
+void PerfLog::pop (unsigned int libmesh_dbg_var(event_id))
 {
   if (this->log_events)
     {
-      libmesh_assert (!log_stack.empty());
+      ThreadLog & thread_log = this->get_thread_log();
+
+      libmesh_assert (!thread_log.stack.empty());
 
 #ifndef NDEBUG
-      PerfData * perf_data = &(log[std::make_pair(header,label)]);
-      if (perf_data != log_stack.top())
-        {
-          libMesh::err << "PerfLog can't pop (" << header << ',' << label << ')' << std::endl;
-          libMesh::err << "From top of stack of running logs:" << std::endl;
-          std::map<std::pair<std::string, std::string>, PerfData>::iterator
-            i = log.begin(), endi = log.end();
-          for (; i != endi; ++i)
-            if (&(i->second) == log_stack.top())
-              libMesh::err << '(' << i->first.first << ',' << i->first.second << ')' << std::endl;
-
-          libmesh_assert_equal_to (perf_data, log_stack.top());
-        }
+      if (event_id != thread_log.stack.back())
+        this->report_bad_pop(event_id, thread_log.stack.back());
 #endif
 
-      total_time += log_stack.top()->stopit();
+      if (count_hardware)
+        this->count_hardware_events(thread_log);
+
+      if (track_memory)
+        this->track_memory_events(thread_log);
+
+      PerfData & perf_data = thread_log.data[thread_log.stack.back()];
+      thread_log.total_time += perf_data.stopit();
+
+      if (trace_events)
+        {
+          TraceEvent event;
+          event.event_id = thread_log.stack.back();
+          event.start = thread_log.stack_start.back();
+          event.stop = perf_data.tstart;
+
+          if (thread_log.trace.size() < max_trace_events)
+            thread_log.trace.push_back(event);
+          else
+            thread_log.trace[thread_log.n_traced % max_trace_events] = event;
+
+          ++thread_log.n_traced;
+        }
 
-      log_stack.pop();
+      thread_log.stack.pop_back();
+      thread_log.stack_start.pop_back();
 
-      if (!log_stack.empty())
-        log_stack.top()->restart();
+      if (!thread_log.stack.empty())
+        thread_log.data[thread_log.stack.back()].restart();
     }
 }
 
 
 
+inline
+void PerfLog::pop (const std::string & label,
+                   const std::string & header)
+{
+  if (this->log_events)
+    this->pop(this->get_event_id(label, header));
+}
+
+
+
 inline
 void PerfLog::pop(const char * label,
                   const char * header)
@@ -454,21 +861,22 @@ void PerfLog::pop(const char * label,
 
 
 inline
-double PerfLog::get_elapsed_time () const
+void PerfLog::record_allocation (std::size_t bytes)
 {
-  struct timeval tnow;
+#ifdef LIBMESH_TLS
+  ++tls_n_allocations;
+  tls_allocated_bytes += bytes;
+#else
+  libmesh_ignore(bytes);
+#endif
+}
 
-  gettimeofday (&tnow, libmesh_nullptr);
 
-  const double elapsed_time = (static_cast<double>(tnow.tv_sec  - tstart.tv_sec) +
-                               static_cast<double>(tnow.tv_usec - tstart.tv_usec)*1.e-6);
-  return elapsed_time;
-}
 
 inline
-double PerfLog::get_active_time() const
+double PerfLog::get_elapsed_time () const
 {
-  return total_time;
+  return PerfData::current_time() - tstart;
 }
 
 } // namespace libMesh
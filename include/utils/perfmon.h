@@ -38,12 +38,108 @@ namespace Papi {
 namespace libMesh
 {
 
+/**
+ * Counts of hardware events.
+ */
+struct HardwareCounts
+{
+  HardwareCounts () :
+    cycles(0),
+    instructions(0),
+    cache_misses(0)
+  {}
+
+  /**
+   * CPU cycles.
+   */
+  long long cycles;
+
+  /**
+   * Instructions retired.
+   */
+  long long instructions;
+
+  /**
+   * Last level cache misses.
+   */
+  long long cache_misses;
+
+  HardwareCounts & operator+= (const HardwareCounts & other)
+  {
+    cycles += other.cycles;
+    instructions += other.instructions;
+    cache_misses += other.cache_misses;
+    return *this;
+  }
+
+  HardwareCounts & operator-= (const HardwareCounts & other)
+  {
+    cycles -= other.cycles;
+    instructions -= other.instructions;
+    cache_misses -= other.cache_misses;
+    return *this;
+  }
+};
+
+
+
+/**
+ * Hardware counters of cycles, instructions and last level cache
+ * misses for the thread which opened them, read through the Linux
+ * perf_event interface.  Where that is not available, or the system
+ * does not allow user processes to count, \p open() fails and the
+ * counts stay zero.
+ *
+ * \brief Counts hardware events for one thread.
+ */
+class HardwareCounters
+{
+public:
+  HardwareCounters ();
+
+  ~HardwareCounters ();
+
+  /**
+   * Starts counting for the calling thread.
+   * \returns \p true if the counters could be opened.
+   */
+  bool open ();
+
+  /**
+   * Stops counting.
+   */
+  void close ();
+
+  /**
+   * \returns \p true if we are counting.
+   */
+  bool is_open () const { return _fd != -1; }
+
+  /**
+   * \returns The counts since \p open().
+   */
+  HardwareCounts read () const;
+
+private:
+  // Our counters can't be shared
+  HardwareCounters (const HardwareCounters &);
+  HardwareCounters & operator= (const HardwareCounters &);
+
+  // The file descriptors of the group leader, counting cycles, and of
+  // the instruction and cache miss counters
+  int _fd;
+  int _instructions_fd;
+  int _cache_misses_fd;
+};
+
 
 
 /**
  * PAPI stands for Performance Application Programming Interface.
  * This class was supposed to provide an interface to the hardware
- * timers that PAPI exposes, but it never really got developed.
+ * timers that PAPI exposes, but it never really got developed.  It
+ * now reports the hardware counts of \p HardwareCounters with the
+ * elapsed time, when they are available.
  *
  * \author Benjamin S. Kirk
  * \date 2002
@@ -70,6 +166,9 @@ private:
   const unsigned int verbose;
   const unsigned int proc_id;
 
+  HardwareCounters counters;
+  HardwareCounts counts_start;
+
 #ifdef HAVE_PAPI_H
   float rtime, ptime, mflops;
   long long int flpins;
@@ -84,6 +183,8 @@ PerfMon::reset ()
 {
   gettimeofday (&the_time_start, libmesh_nullptr);
 
+  counts_start = counters.read();
+
 #ifdef HAVE_PAPI_H
   Papi::PAPI_flops (&rtime, & ptime, &flpins, &mflops);
 #endif
@@ -97,6 +198,9 @@ PerfMon::print (std::string msg, std::ostream & my_out)
 {
   gettimeofday (&the_time_stop, libmesh_nullptr);
 
+  HardwareCounts counts = counters.read();
+  counts -= counts_start;
+
 #ifdef HAVE_PAPI_H
   Papi::PAPI_flops (&rtime, & ptime, &flpins, &mflops);
 #endif
@@ -120,6 +224,15 @@ PerfMon::print (std::string msg, std::ostream & my_out)
                    << elapsed_time << " (sec)"
                    << std::endl;
 
+          if (counters.is_open())
+            my_out << " " << ((msg == "NULL") ? id_string : msg)
+                   << ": cycles: " << counts.cycles
+                   << ", instructions: " << counts.instructions
+                   << ", IPC: "
+                   << (counts.cycles ? double(counts.instructions) / counts.cycles : 0.)
+                   << ", LLC misses: " << counts.cache_misses
+                   << std::endl;
+
 #ifdef HAVE_PAPI_H
           if (msg == "NULL")
             my_out << " " << id_string
@@ -148,6 +261,8 @@ PerfMon::PerfMon (std::string id,
   verbose(v),
   proc_id(pid)
 {
+  counters.open();
+
   reset ();
 }
 
@@ -80,6 +80,16 @@ public:
                                             const MeshBase & mesh,
                                             const PointLocatorBase * master = libmesh_nullptr);
 
+  /**
+   * \returns The position of \p p along a Morton (Z-order) curve
+   * through the box from \p lower to \p upper, at a resolution of
+   * 2^21 in each direction.  Points outside the box are clamped to
+   * it.  Sorting points by this code keeps nearby ones together.
+   */
+  static uint64_t morton_code (const Point & p,
+                               const Point & lower,
+                               const Point & upper);
+
   /**
    * Clears the \p PointLocator.
    */
@@ -134,6 +144,11 @@ public:
    */
   bool initialized () const;
 
+  /**
+   * \returns The mesh this locator searches.
+   */
+  const MeshBase & get_mesh () const { return _mesh; }
+
   /**
    * Enables out-of-mesh mode.  In this mode, if asked to find a point
    * that is contained in no mesh at all, the point locator will
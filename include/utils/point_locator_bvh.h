@@ -0,0 +1,210 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_POINT_LOCATOR_BVH_H
+#define LIBMESH_POINT_LOCATOR_BVH_H
+
+// Local Includes
+#include "libmesh/point_locator_base.h"
+#include "libmesh/point.h"
+
+// C++ includes
+#include <vector>
+
+namespace libMesh
+{
+
+// Forward Declarations
+class MeshBase;
+class Elem;
+
+/**
+ * This is a point locator which searches a bounding volume hierarchy
+ * over the bounding boxes of the active elements of a mesh.
+ *
+ * Unlike the trees of \p PointLocatorTree, which put each element
+ * into every bin it overlaps, the hierarchy holds each element
+ * exactly once, so stretched elements cost no more than others.  The
+ * elements are sorted along a Morton curve through their centroids,
+ * and the hierarchy is built by splitting the sorted list at the
+ * highest bit in which the codes differ (a "linear" BVH).  Nodes and
+ * element boxes are kept in flat arrays, children next to each
+ * other, and searched without recursion.
+ *
+ * Points are tested against elements with \p Elem::contains_point()
+ * and, if a tolerance was set with \p set_close_to_point_tol() and
+ * nothing contains the point, with \p Elem::close_to_point(), just
+ * as \p PointLocatorTree does.  Use \p PointLocatorBase::build() or
+ * \p MeshBase::set_point_locator_type() to create objects of this
+ * type.
+ */
+class PointLocatorBVH : public PointLocatorBase
+{
+public:
+  /**
+   * Constructor.  Needs the \p mesh in which the points should be
+   * located.  Only a master locator holds a hierarchy; the others
+   * use the one of their \p master.  If \p local_elements is true,
+   * only the active local elements are searched.
+   */
+  PointLocatorBVH (const MeshBase & mesh,
+                   bool local_elements = false,
+                   const PointLocatorBase * master = libmesh_nullptr);
+
+  /**
+   * Destructor.
+   */
+  ~PointLocatorBVH ();
+
+  /**
+   * Clears the locator.
+   */
+  virtual void clear() libmesh_override;
+
+  /**
+   * Initializes the locator, building the hierarchy if we are the
+   * master.
+   */
+  virtual void init() libmesh_override;
+
+  /**
+   * Locates the element in which the point with global coordinates
+   * \p p is located, optionally restricted to a set of allowed
+   * subdomains.  The element found last is tried first.
+   */
+  virtual const Elem * operator() (const Point & p,
+                                   const std::set<subdomain_id_type> * allowed_subdomains = libmesh_nullptr) const libmesh_override;
+
+  /**
+   * Locates all elements which are within the close-to-point
+   * tolerance of \p p, optionally restricted to a set of allowed
+   * subdomains.
+   */
+  virtual void operator() (const Point & p,
+                           std::set<const Elem *> & candidate_elements,
+                           const std::set<subdomain_id_type> * allowed_subdomains = libmesh_nullptr) const libmesh_override;
+
+  /**
+   * Adds to \p elems every element whose bounding box overlaps the
+   * box from \p lower to \p upper, optionally restricted to a set
+   * of allowed subdomains.  The elements themselves are not tested,
+   * so some of them may not meet the box at all.
+   */
+  void elements_in_box (const Point & lower,
+                        const Point & upper,
+                        std::vector<const Elem *> & elems,
+                        const std::set<subdomain_id_type> * allowed_subdomains = libmesh_nullptr) const;
+
+  /**
+   * Enables out-of-mesh mode.  In this mode, if asked to find a point
+   * that is contained in no mesh at all, the point locator will
+   * return a NULL pointer instead of crashing.  Per default, this
+   * mode is off.
+   */
+  virtual void enable_out_of_mesh_mode () libmesh_override;
+
+  /**
+   * Disables out-of-mesh mode (default).  If asked to find a point
+   * that is contained in no mesh at all, the point locator will now
+   * crash.
+   */
+  virtual void disable_out_of_mesh_mode () libmesh_override;
+
+protected:
+  /**
+   * A node of the hierarchy.  For an interior node, \p count is zero
+   * and its children are nodes \p first and \p first+1; a leaf holds
+   * elements \p first through \p first+count-1.  \p size is the
+   * largest diagonal of an element box below the node; tolerances
+   * are relative to it, as in \p TreeNode::bounds_point().
+   */
+  struct BVHNode
+  {
+    Point lower, upper;
+    Real size;
+    unsigned int first, count;
+  };
+
+  /**
+   * Builds the hierarchy over the elements of \p _mesh.
+   */
+  void build_hierarchy ();
+
+  /**
+   * Builds the node \p n over the sorted elements \p begin through
+   * \p end-1, whose Morton codes are in \p codes, and everything
+   * below it.
+   */
+  void build_node (unsigned int n,
+                   unsigned int begin,
+                   unsigned int end,
+                   const std::vector<uint64_t> & codes);
+
+  /**
+   * Walks the hierarchy for the elements whose boxes, padded by \p
+   * tol times their size, hold \p p.  With \p all false, this
+   * returns the first one which contains \p p (or is close to it, if
+   * \p use_close_to_point); otherwise it adds all those close to \p p
+   * to \p candidates and returns NULL.
+   */
+  const Elem * search (const Point & p,
+                       const std::set<subdomain_id_type> * allowed_subdomains,
+                       bool use_close_to_point,
+                       Real tol,
+                       bool all,
+                       std::set<const Elem *> * candidates) const;
+
+  /**
+   * The locator which owns the hierarchy we use: this one if we are
+   * the master, or the master otherwise.
+   */
+  const PointLocatorBVH * _bvh;
+
+  /**
+   * The nodes of the hierarchy, root first.  Only used by the master.
+   */
+  std::vector<BVHNode> _nodes;
+
+  /**
+   * The elements in Morton order, and their bounding boxes and sizes.
+   * Only used by the master.
+   */
+  std::vector<const Elem *> _elems;
+  std::vector<Point> _elem_lower, _elem_upper;
+  std::vector<Real> _elem_size;
+
+  /**
+   * The element found last, which is tried first next time.
+   */
+  mutable const Elem * _element;
+
+  /**
+   * \p true if out-of-mesh mode is enabled.
+   */
+  bool _out_of_mesh_mode;
+
+  /**
+   * \p true if only the local elements are searched.
+   */
+  bool _local_elements;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_POINT_LOCATOR_BVH_H
@@ -26,6 +26,7 @@
 
 // C++ includes
 #include <cstddef>
+#include <vector>
 
 namespace libMesh
 {
@@ -115,6 +116,35 @@ public:
                            std::set<const Elem *> & candidate_elements,
                            const std::set<subdomain_id_type> * allowed_subdomains = libmesh_nullptr) const libmesh_override;
 
+  /**
+   * Locates each of the \p points, as operator() would, and stores
+   * the element containing points[i] in elems[i] and its master
+   * element coordinates in reference_points[i].  Points not found in
+   * out-of-mesh mode get a NULL element.
+   *
+   * The queries are sorted along a Morton (Z-order) curve, so that
+   * consecutive ones tend to lie in the same element and tree bins,
+   * and are split among threads.
+   */
+  void locate_points (const std::vector<Point> & points,
+                      std::vector<const Elem *> & elems,
+                      std::vector<Point> & reference_points,
+                      const std::set<subdomain_id_type> * allowed_subdomains = libmesh_nullptr) const;
+
+  /**
+   * Locates the element containing \p p as operator() does, but
+   * starting from \p guess rather than the element found last.  This
+   * leaves the locator unchanged, so several threads may call it at
+   * once, each with its own guess.
+   *
+   * If \p guess doesn't contain \p p, we walk from it through the
+   * neighbors toward \p p for a few steps before asking the tree, so
+   * a point near the one before is found in constant time.
+   */
+  const Elem * find_element (const Point & p,
+                             const Elem * guess,
+                             const std::set<subdomain_id_type> * allowed_subdomains = libmesh_nullptr) const;
+
   /**
    * As a fallback option, it's helpful to be able to do a linear
    * search over the entire mesh. This can be used if operator()
@@ -163,6 +193,16 @@ public:
   unsigned int get_target_bin_size() const;
 
 protected:
+  /**
+   * Walks from \p start through active neighbors, each time to the
+   * one whose centroid is closest to \p p, until an element we
+   * search contains \p p.  \returns NULL if no neighbor is closer
+   * or none is found within a few steps.
+   */
+  const Elem * walk_to_point (const Point & p,
+                              const Elem * start,
+                              const std::set<subdomain_id_type> * allowed_subdomains) const;
+
   /**
    * Pointer to our tree.  The tree is built at run-time
    * through \p init().  For servant PointLocators (not master),
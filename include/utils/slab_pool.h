@@ -0,0 +1,158 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_SLAB_POOL_H
+#define LIBMESH_SLAB_POOL_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+
+// C++ includes
+#include <cstddef>
+#include <vector>
+
+namespace libMesh
+{
+
+/**
+ * A \p SlabPool hands out fixed-size blocks of memory carved out of
+ * large slabs, keeping freed blocks on a free list for reuse.  This
+ * replaces one heap allocation per object with one per slab for
+ * classes like \p Elem and \p Node which are created and destroyed
+ * by the millions during refinement.
+ *
+ * A \p SlabPool itself is not thread-safe.  The static \p
+ * pooled_allocate() and \p pooled_deallocate() members manage a
+ * locked set of pools, one per block size class, which can be used
+ * to implement class-specific operator new and delete.  Where the
+ * compiler supports thread-local storage each thread caches a few
+ * free blocks of each size class, and only takes the lock to move
+ * them to or from the global pools in batches.
+ */
+class SlabPool
+{
+public:
+  /**
+   * Constructor.  Blocks are \p block_size bytes (rounded up to a
+   * multiple of \p alignment), and are allocated \p blocks_per_slab
+   * at a time.
+   */
+  explicit
+  SlabPool (std::size_t block_size,
+            std::size_t blocks_per_slab = 256);
+
+  /**
+   * Destructor.  Frees all slabs; any blocks still in use become
+   * invalid.
+   */
+  ~SlabPool ();
+
+  /**
+   * \returns A block of \p block_size() bytes.
+   */
+  void * allocate ();
+
+  /**
+   * Returns the block \p p, which must have come from \p allocate(),
+   * to the pool.
+   */
+  void deallocate (void * p);
+
+  /**
+   * Frees every slab none of whose blocks are in use.
+   *
+   * \returns The number of bytes freed.
+   */
+  std::size_t release_unused ();
+
+  /**
+   * \returns The size of the blocks this pool returns.
+   */
+  std::size_t block_size () const { return _block_size; }
+
+  /**
+   * \returns The number of blocks currently in use.
+   */
+  std::size_t n_used () const { return _n_used; }
+
+  /**
+   * \returns The number of bytes allocated in slabs.
+   */
+  std::size_t n_bytes () const
+  { return _slabs.size() * _blocks_per_slab * _block_size; }
+
+  /**
+   * \returns Memory for an object of \p size bytes from the global
+   * pool for that size class.  Safe to call from multiple threads.
+   */
+  static void * pooled_allocate (std::size_t size);
+
+  /**
+   * Returns memory obtained from \p pooled_allocate(size) to its
+   * pool.  Safe to call from multiple threads.
+   */
+  static void pooled_deallocate (void * p, std::size_t size);
+
+  /**
+   * Calls \p release_unused() on all the global pools, after
+   * returning the calling thread's cached blocks to them.  Blocks
+   * cached by other threads still count as in use.
+   *
+   * \returns The number of bytes freed.
+   */
+  static std::size_t release_unused_pooled_memory ();
+
+  /**
+   * Returns the blocks cached by the calling thread to the global
+   * pools.  Threads which allocated pooled objects should call this
+   * before they exit, since their cached blocks are lost otherwise.
+   */
+  static void release_thread_cache ();
+
+  /**
+   * Blocks are aligned to, and sized in multiples of, this many bytes.
+   */
+  static const std::size_t alignment = 16;
+
+  /**
+   * Objects larger than this many bytes bypass the global pools.
+   */
+  static const std::size_t max_pooled_size = 2048;
+
+private:
+
+  /**
+   * Free blocks store the link to the next free block in place.
+   */
+  struct FreeBlock
+  {
+    FreeBlock * next;
+  };
+
+  const std::size_t _block_size;
+  const std::size_t _blocks_per_slab;
+
+  std::vector<char *> _slabs;
+  FreeBlock * _free;
+  std::size_t _n_used;
+};
+
+} // namespace libMesh
+
+#endif // LIBMESH_SLAB_POOL_H
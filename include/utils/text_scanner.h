@@ -0,0 +1,317 @@
+// The libMesh Finite Element Library.
+// Copyright (C) 2002-2017 Benjamin S. Kirk, John W. Peterson, Roy H. Stogner
+
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+
+
+
+#ifndef LIBMESH_TEXT_SCANNER_H
+#define LIBMESH_TEXT_SCANNER_H
+
+// Local includes
+#include "libmesh/libmesh_common.h"
+#include "libmesh/auto_ptr.h"
+
+// C++ includes
+#include <cstdio> // EOF
+#include <iosfwd>
+#include <limits>
+#include <string>
+
+namespace libMesh
+{
+
+// Forward Declarations
+class MappedFile;
+
+/**
+ * A forward-only reader of whitespace separated ASCII text, for the
+ * mesh readers which used to parse their files with \p std::istream.
+ * Its operators behave like the formatted input of an istream in the
+ * "C" locale, but work directly on a range of characters: either a
+ * whole file mapped into memory with \p MappedFile, the contents of a
+ * (possibly compressed) stream, or a range owned by the caller.
+ *
+ * The static \p parse_integer() and \p parse_real() functions convert
+ * a single number on a range of characters, like \p std::from_chars,
+ * so that independent blocks of records can be parsed concurrently.
+ * Real numbers may use a Fortran style 'D' exponent.
+ *
+ * \brief Fast tokenizer for ASCII mesh files.
+ */
+class TextScanner
+{
+public:
+  /**
+   * Constructs a scanner with nothing to read.
+   */
+  TextScanner ();
+
+  /**
+   * Constructs a scanner over the characters [begin, end), which
+   * must stay valid for as long as they are read.
+   */
+  TextScanner (const char * begin, const char * end);
+
+  ~TextScanner ();
+
+  /**
+   * Maps the file \p name into memory and reads from its beginning.
+   */
+  void open (const std::string & name);
+
+  /**
+   * Copies what is left of \p in and reads from its beginning.
+   */
+  void open (std::istream & in);
+
+  /**
+   * \returns The next character without extracting it, or \p EOF at
+   * the end of the range.
+   */
+  int peek () const
+  { return _pos == _end ? EOF : static_cast<unsigned char>(*_pos); }
+
+  /**
+   * Extracts the next character.  \returns It, or \p EOF at the end
+   * of the range.
+   */
+  int get ();
+
+  /**
+   * Puts back the last character extracted.
+   */
+  void unget ();
+
+  /**
+   * Extracts the rest of the current line, without its line break,
+   * into \p line.  \returns \p false, and sets the fail flag, if
+   * there was nothing left to read.
+   */
+  bool getline (std::string & line);
+
+  /**
+   * Sets \p line_begin and \p line_end to the rest of the current
+   * line, without its line break, and moves past it.  \returns \p
+   * false, and sets the fail flag, if there was nothing left to read.
+   */
+  bool getline (const char * & line_begin, const char * & line_end);
+
+  /**
+   * Extracts the next whitespace separated token or number.  On
+   * failure the value is left unchanged and the fail flag is set,
+   * which makes all further extractions fail.
+   */
+  TextScanner & operator>> (char & c);
+  TextScanner & operator>> (std::string & s);
+  TextScanner & operator>> (int & i)                { return this->read_integer(i); }
+  TextScanner & operator>> (unsigned int & i)       { return this->read_integer(i); }
+  TextScanner & operator>> (long & i)               { return this->read_integer(i); }
+  TextScanner & operator>> (unsigned long & i)      { return this->read_integer(i); }
+  TextScanner & operator>> (long long & i)          { return this->read_integer(i); }
+  TextScanner & operator>> (unsigned long long & i) { return this->read_integer(i); }
+  TextScanner & operator>> (float & x)              { return this->read_real(x); }
+  TextScanner & operator>> (double & x)             { return this->read_real(x); }
+  TextScanner & operator>> (long double & x)        { return this->read_real(x); }
+
+  /**
+   * \returns \p true if an extraction has failed.
+   */
+  bool fail () const { return _fail; }
+
+  /**
+   * \returns \p true if everything has been read.
+   */
+  bool eof () const { return _pos == _end; }
+
+  /**
+   * \returns The next character to be read.
+   */
+  const char * position () const { return _pos; }
+
+  /**
+   * \returns The end of the range being read.
+   */
+  const char * end () const { return _end; }
+
+  /**
+   * Continues reading from \p pos, which must lie in the range.
+   */
+  void seek (const char * pos)
+  {
+    libmesh_assert (pos >= _begin && pos <= _end);
+    _pos = pos;
+  }
+
+  /**
+   * \returns The first character after the line break ending the line
+   * which \p pos is on, or \p end if there is none.
+   */
+  static const char * next_line (const char * pos, const char * end);
+
+  /**
+   * \returns The line break ending the line which \p pos is on, after
+   * stripping any carriage return before it, or \p end if there is
+   * none.
+   */
+  static const char * line_end (const char * pos, const char * end);
+
+  /**
+   * \returns The first non-whitespace character in [begin, end).
+   */
+  static const char * skip_whitespace (const char * begin, const char * end)
+  {
+    while (begin != end && is_space(*begin))
+      ++begin;
+    return begin;
+  }
+
+  /**
+   * Converts the optionally signed decimal integer at the start of
+   * [begin, end), after any leading whitespace, into \p value.
+   *
+   * \returns The first character after the integer, or \p begin, with
+   * \p value unchanged, if there was no integer to convert or it
+   * overflowed.
+   */
+  template <typename T>
+  static const char * parse_integer (const char * begin,
+                                     const char * end,
+                                     T & value);
+
+  /**
+   * Converts the decimal floating point number at the start of [begin,
+   * end), after any leading whitespace, into \p value.  The exponent
+   * may be marked by any of 'e', 'E', 'd' or 'D'.
+   *
+   * Numbers with at most 15 significant digits and small exponents,
+   * which is what mesh generators write, are converted exactly
+   * without any library call; others go through \p strtod.
+   *
+   * \returns The first character after the number, or \p begin, with
+   * \p value unchanged, if there was no number to convert.
+   */
+  static const char * parse_real (const char * begin,
+                                  const char * end,
+                                  double & value);
+  static const char * parse_real (const char * begin,
+                                  const char * end,
+                                  float & value);
+  static const char * parse_real (const char * begin,
+                                  const char * end,
+                                  long double & value);
+
+private:
+
+  static bool is_space (const char c)
+  { return c == ' ' || (c >= '\t' && c <= '\r'); }
+
+  template <typename T>
+  TextScanner & read_integer (T & value)
+  {
+    if (!_fail)
+      {
+        const char * after = parse_integer(_pos, _end, value);
+        if (after == _pos)
+          _fail = true;
+        _pos = after;
+      }
+    return *this;
+  }
+
+  template <typename T>
+  TextScanner & read_real (T & value)
+  {
+    if (!_fail)
+      {
+        const char * after = parse_real(_pos, _end, value);
+        if (after == _pos)
+          _fail = true;
+        _pos = after;
+      }
+    return *this;
+  }
+
+  // Not copyable
+  TextScanner (const TextScanner &);
+  TextScanner & operator= (const TextScanner &);
+
+  /**
+   * The range being read, and the next character to read.
+   */
+  const char * _begin;
+  const char * _end;
+  const char * _pos;
+
+  bool _fail;
+
+  /**
+   * The storage of a range which was opened by the scanner itself.
+   */
+  UniquePtr<MappedFile> _file;
+  std::string _buffer;
+};
+
+
+
+// ------------------------------------------------------------
+// TextScanner inline methods
+template <typename T>
+inline
+const char * TextScanner::parse_integer (const char * begin,
+                                         const char * end,
+                                         T & value)
+{
+  const char * p = skip_whitespace(begin, end);
+
+  bool negative = false;
+  if (p != end && (*p == '-' || *p == '+'))
+    negative = (*(p++) == '-');
+
+  if (negative && !std::numeric_limits<T>::is_signed)
+    return begin;
+
+  // Accumulate the magnitude, which for negative numbers may be one
+  // more than the largest positive value.
+  typedef unsigned long long magnitude_type;
+  const magnitude_type limit = negative ?
+    static_cast<magnitude_type>(-(std::numeric_limits<T>::min() + 1)) + 1 :
+    static_cast<magnitude_type>(std::numeric_limits<T>::max());
+
+  const char * const digits = p;
+  magnitude_type magnitude = 0;
+  for (; p != end && *p >= '0' && *p <= '9'; ++p)
+    {
+      const unsigned int digit = *p - '0';
+      if (magnitude > (limit - digit) / 10)
+        return begin;
+      magnitude = magnitude * 10 + digit;
+    }
+
+  if (p == digits)
+    return begin;
+
+  // Negate one less than the magnitude, which cannot overflow
+  if (negative && magnitude)
+    value = static_cast<T>(-static_cast<T>(magnitude - 1) - 1);
+  else
+    value = static_cast<T>(magnitude);
+
+  return p;
+}
+
+} // namespace libMesh
+
+#endif // LIBMESH_TEXT_SCANNER_H
@@ -76,6 +76,14 @@ public:
    */
   Xdr (const std::string & name="", const XdrMODE m=UNKNOWN);
 
+  /**
+   * Constructor.  Reads from or writes to \p buffer rather than a
+   * file.  When writing, \p buffer is overwritten with the encoded
+   * data when the Xdr object is closed; when reading, \p buffer must
+   * stay unchanged until then.
+   */
+  Xdr (std::vector<char> & buffer, const XdrMODE m);
+
   /**
    * Destructor.  Closes the file if it is open.
    */
@@ -166,6 +174,17 @@ public:
 
 private:
 
+  /**
+   * Opens \p mem_buffer for reading or writing.
+   */
+  void open_buffer ();
+
+  /**
+   * Copies what has been written to a memory buffer into \p
+   * mem_buffer.
+   */
+  void close_buffer ();
+
   /**
    * Helper method for reading different data types
    */
@@ -219,8 +238,19 @@ private:
    */
   FILE * fp;
 
+  /**
+   * The data written by \p open_memstream, when encoding to memory.
+   */
+  char * mem_data;
+  std::size_t mem_size;
+
 #endif
 
+  /**
+   * The memory buffer being read or written, if any.
+   */
+  std::vector<char> * mem_buffer;
+
   /**
    * The input file stream.
    */
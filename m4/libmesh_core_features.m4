@@ -608,6 +608,12 @@ if test "$enablexdr" != no ; then
                                        [enablexdr=no])
                      ])
 fi
+
+# open_memstream and fmemopen let Xdr encode to and decode from
+# memory buffers without going through a temporary file
+if test "$enablexdr" != no ; then
+   AC_CHECK_FUNCS([open_memstream fmemopen])
+fi
 # -------------------------------------------------------------
 
 
@@ -663,6 +669,27 @@ fi
 
 
 
+# -------------------------------------------------------------
+# Reference Count Statistics -- disabled by default
+# Counts objects by class in every mode, not only in debug mode
+# -------------------------------------------------------------
+AC_ARG_ENABLE(reference-count-statistics,
+              AS_HELP_STRING([--enable-reference-count-statistics],
+                             [count reference counted objects by class in all modes]),
+              enablerefctstats=$enableval,
+              enablerefctstats=no)
+
+if test "$enablerefctstats" != no ; then
+  if test "$enablerefct" != no && test "$ac_cv_cxx_rtti" = yes; then
+    AC_DEFINE(ENABLE_REFERENCE_COUNT_STATISTICS, 1,
+             [Flag indicating if objects should be counted by class in all modes])
+    AC_MSG_RESULT(<<< Configuring library with reference count statistics >>>)
+  fi
+fi
+# -------------------------------------------------------------
+
+
+
 # -------------------------------------------------------------
 # Performance Logging -- disabled by default
 # -------------------------------------------------------------
@@ -273,6 +273,16 @@ if (test "$enablebz2" != no) ; then
                    [Flag indicating bzip2/bunzip2 are available for handling compressed .bz2 files])
        fi
    fi
+
+   # Prefer streaming through libbz2 to shelling out, when we can
+   AC_CHECK_HEADERS(bzlib.h, have_bzlib_h=yes)
+   AC_CHECK_LIB(bz2, BZ2_bzCompressInit, have_libbz2=yes)
+   if (test "$have_bzlib_h" = yes -a "$have_libbz2" = yes) ; then
+     AC_MSG_RESULT(<<< Using libbz2 for streaming compressed .bz2 files >>>)
+     AC_DEFINE(HAVE_LIBBZ2, 1,
+               [Flag indicating libbz2 is available for streaming compressed .bz2 files])
+     libmesh_optional_LIBS="-lbz2 $libmesh_optional_LIBS"
+   fi
 fi
 # -------------------------------------------------------------
 
@@ -294,6 +304,16 @@ if (test "$enablexz" != no) ; then
       AC_DEFINE(HAVE_XZ, 1,
                 [Flag indicating xz is available for handling compressed .xz files])
    fi
+
+   # Prefer streaming through liblzma to shelling out, when we can
+   AC_CHECK_HEADERS(lzma.h, have_lzma_h=yes)
+   AC_CHECK_LIB(lzma, lzma_easy_encoder, have_liblzma=yes)
+   if (test "$have_lzma_h" = yes -a "$have_liblzma" = yes) ; then
+     AC_MSG_RESULT(<<< Using liblzma for streaming compressed .xz files >>>)
+     AC_DEFINE(HAVE_LIBLZMA, 1,
+               [Flag indicating liblzma is available for streaming compressed .xz files])
+     libmesh_optional_LIBS="-llzma $libmesh_optional_LIBS"
+   fi
 fi
 # -------------------------------------------------------------
 
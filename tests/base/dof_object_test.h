@@ -14,7 +14,8 @@
   CPPUNIT_TEST( testSetNSystems );              \
   CPPUNIT_TEST( testSetNVariableGroups );       \
   CPPUNIT_TEST( testManualDofCalculation );     \
-  CPPUNIT_TEST( testJensEftangBug );
+  CPPUNIT_TEST( testJensEftangBug );            \
+  CPPUNIT_TEST( testIndexArena );
 
 using namespace libMesh;
 
@@ -185,6 +186,33 @@ public:
     CPPUNIT_ASSERT_EQUAL (aobject.dof_number(0,2,0), static_cast<dof_id_type>(193));
     CPPUNIT_ASSERT_EQUAL (aobject.dof_number(1,0,0), static_cast<dof_id_type>(  1));
   }
+
+  void testIndexArena()
+  {
+    DofObject aobject(*instance);
+    dof_id_type buf0[] = {2, 8, 257, 0, 257, 96, 257, 192, 257, 0};
+    aobject.set_buffer(std::vector<dof_id_type>(buf0, buf0+10));
+
+    CPPUNIT_ASSERT_EQUAL (aobject.arena_indexing_size(), static_cast<std::size_t>(11));
+
+    std::vector<dof_id_type> arena(aobject.arena_indexing_size());
+    aobject.move_indexing_to_arena(&arena[0]);
+
+    CPPUNIT_ASSERT_EQUAL (arena[0], static_cast<dof_id_type>(10));
+    CPPUNIT_ASSERT_EQUAL (aobject.dof_number(0,1,0), static_cast<dof_id_type>( 96));
+
+    // Writes that keep the size go to the arena
+    aobject.set_vg_dof_base(0, 0, 1);
+    CPPUNIT_ASSERT_EQUAL (arena[4], static_cast<dof_id_type>(1));
+    CPPUNIT_ASSERT_EQUAL (aobject.dof_number(0,0,0), static_cast<dof_id_type>(  1));
+
+    // Resizing copies the buffer back out first
+    aobject.add_system();
+    CPPUNIT_ASSERT_EQUAL (aobject.n_systems(), 3u);
+    CPPUNIT_ASSERT_EQUAL (arena[0], static_cast<dof_id_type>(10));
+    CPPUNIT_ASSERT_EQUAL (aobject.dof_number(0,0,0), static_cast<dof_id_type>(  1));
+    CPPUNIT_ASSERT_EQUAL (aobject.dof_number(1,0,0), static_cast<dof_id_type>(  0));
+  }
 };
 
 #endif // #ifdef __dof_object_test_h__